@@ -0,0 +1,48 @@
+// Full-graph BFS: Graph::bfs vs CSRGraph::bfs vs direction-optimizing bfs_tree
+// g++ -std=c++17 -O2 -pthread bench/bfs.cpp -o bfs
+#include "../include/graph.hpp"
+#include <chrono>
+#include <random>
+#include <thread>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    std::mt19937 rng(23);
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int n : {100'000, 1'000'000}) {
+        // Social-like: low diameter, skewed degrees (endpoints drawn with a square-law bias)
+        const int avg_degree = 16;
+        MayDSA::Graph<int> g(false);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        for (long long e = 0; e < static_cast<long long>(n) * avg_degree / 2; ++e) {
+            double a = unit(rng), b = unit(rng);
+            g.add_edge(static_cast<int>(a * a * (n - 1)), static_cast<int>(b * (n - 1)));
+        }
+        const int missing = n;  // Isolated target forces a full traversal
+        g.add_node(missing);
+        MayDSA::CSRGraph<int> csr = g.freeze();
+        std::cout << "V=" << csr.vertex_count() << " E=" << csr.edge_count() / 2 << "\n";
+
+        double graph_ms = time_ms([&] { g.bfs(0, missing); });
+        double csr_ms = time_ms([&] { csr.bfs(0, missing); });
+        std::cout << "  Graph::bfs " << graph_ms << " ms, CSRGraph::bfs " << csr_ms << " ms\n";
+        for (size_t th = 1; th <= max_threads; th *= 2) {
+            size_t reached = 0;
+            double ms = time_ms([&] {
+                auto tree = csr.bfs_tree(csr.id_of(0), th);
+                for (uint32_t d : tree.distance) reached += d != csr.npos;
+            });
+            std::cout << "  bfs_tree x" << th << " " << ms << " ms (" << reached << " reached)\n";
+        }
+        double hop_ms = time_ms([&] { csr.bfs_tree(csr.id_of(0), max_threads, 2); });
+        std::cout << "  2-hop bfs_tree " << hop_ms << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Priority-queue scaling from 1 to N threads: ConcurrentHeap (relaxed) vs mutex + Heap
+// g++ -std=c++17 -O2 -pthread bench/concurrent_heap.cpp -o concurrent_heap
+#include "../include/concurrent_heap.hpp"
+#include "../include/heap.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// The baseline being replaced: one global mutex around a Heap
+class LockedHeap {
+    std::mutex m;
+    MayDSA::Heap<int> heap;
+
+public:
+    void push(int v) {
+        std::lock_guard<std::mutex> lock(m);
+        heap.push(v);
+    }
+
+    bool try_pop(int& out) {
+        std::lock_guard<std::mutex> lock(m);
+        if (heap.empty()) return false;
+        out = heap.pop_value();
+        return true;
+    }
+};
+
+// Scheduler-like mix: every thread alternates push/pop on a prefilled queue; returns Mops/s
+template<typename Q>
+double run(Q& q, int threads, int ops_per_thread) {
+    std::mt19937 rng(7);
+    for (int i = 0; i < 100'000; ++i) q.push(static_cast<int>(rng() % 1'000'000));
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            std::mt19937 local(t);
+            while (!go.load()) std::this_thread::yield();
+            int v = 0;
+            for (int i = 0; i < ops_per_thread; ++i) {
+                if (q.try_pop(v)) q.push(v + static_cast<int>(local() % 1000));
+            }
+        });
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& t : pool) t.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * threads * ops_per_thread / secs / 1e6;
+}
+
+int main() {
+    int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    const int ops = 300'000;
+    std::cout << "threads  relaxed(c=2,d=2)  relaxed(c=4,d=1)  mutex+Heap  (Mops/s)\n";
+    std::vector<int> counts;
+    for (int t = 1; t < max_threads; t *= 2) counts.push_back(t);
+    counts.push_back(max_threads);
+    for (int t : counts) {
+        MayDSA::ConcurrentHeap<int> strict_ish(t, 2, 2), loose(t, 4, 1);
+        LockedHeap locked;
+        double a = run(strict_ish, t, ops);
+        double b = run(loose, t, ops);
+        double c = run(locked, t, ops);
+        std::cout << t << "\t " << a << "\t\t   " << b << "\t\t     " << c << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// MPMC throughput from 2 to N threads: ConcurrentQueue / ConcurrentStack vs mutex + LinkedList
+// g++ -std=c++17 -O2 -pthread bench/concurrent_queue.cpp -o concurrent_queue
+#include "../include/concurrent_queue.hpp"
+#include "../include/concurrent_stack.hpp"
+#include "../include/linked_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The baseline being replaced: one global mutex around a LinkedList
+class LockedList {
+    std::mutex m;
+    MayDSA::LinkedList<int> list;
+
+public:
+    bool try_push(int v) {
+        std::lock_guard<std::mutex> lock(m);
+        list.push_back(v);
+        return true;
+    }
+
+    bool try_pop(int& out) {
+        std::lock_guard<std::mutex> lock(m);
+        if (list.size() == 0) return false;
+        out = list.accessHead()->data;
+        list.pop_front();
+        return true;
+    }
+};
+
+// threads/2 producers and threads/2 consumers (at least one of each); returns Mops/s
+template<typename Q>
+double run(int threads, int ops_per_producer) {
+    Q q;
+    int producers = std::max(1, threads / 2), consumers = std::max(1, threads - producers);
+    long long total = static_cast<long long>(producers) * ops_per_producer;
+    std::atomic<long long> consumed{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+
+    for (int p = 0; p < producers; ++p) {
+        pool.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            for (int i = 0; i < ops_per_producer; ++i) q.try_push(i);
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        pool.emplace_back([&] {
+            while (!go.load()) std::this_thread::yield();
+            int v;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (q.try_pop(v)) consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for (auto& t : pool) t.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * total / secs / 1e6;  // push + pop per item
+}
+
+int main() {
+    int max_threads = std::max(2u, std::thread::hardware_concurrency());
+    const int ops = 500'000;
+    std::cout << "threads  ConcurrentQueue  ConcurrentStack  mutex+LinkedList  (Mops/s)\n";
+    std::vector<int> counts;
+    for (int t = 2; t < max_threads; t *= 2) counts.push_back(t);
+    counts.push_back(max_threads);
+    for (int t : counts) {
+        std::cout << t << "\t " << run<MayDSA::ConcurrentQueue<int>>(t, ops)
+                  << "\t\t  " << run<MayDSA::ConcurrentStack<int>>(t, ops)
+                  << "\t\t   " << run<LockedList>(t, ops) << "\n";
+    }
+    return 0;
+}
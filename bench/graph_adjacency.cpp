@@ -0,0 +1,53 @@
+// Edge-existence checks and removals against hub vertices for each Graph adjacency policy
+// g++ -std=c++17 -O2 bench/graph_adjacency.cpp -o graph_adjacency
+#include "../include/graph.hpp"
+#include <chrono>
+#include <random>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+const int hubs = 10, hub_degree = 20'000, queries = 50'000;
+
+template<typename Policy>
+void run(const char* name, const std::vector<MayDSA::WeightedEdge<int>>& edges) {
+    MayDSA::Graph<int, Policy> one_by_one(true), batched(true);
+    double add_ms = time_ms([&] {
+        for (const auto& e : edges) one_by_one.add_edge(e.u, e.v, e.weight);
+    });
+    double batch_ms = time_ms([&] { batched.add_edges(edges); });
+
+    std::mt19937 rng(7);
+    size_t hits = 0;
+    double query_ms = time_ms([&] {
+        for (int q = 0; q < queries; ++q) hits += batched.has_edge(static_cast<int>(rng() % hubs), static_cast<int>(rng() % (4 * hub_degree)));
+    });
+
+    std::vector<std::pair<int, int>> doomed;
+    for (int q = 0; q < queries / 10; ++q) doomed.push_back({static_cast<int>(rng() % hubs), static_cast<int>(rng() % (4 * hub_degree))});
+    double remove_ms = time_ms([&] {
+        for (const auto& [u, v] : doomed) one_by_one.remove_edge(u, v);
+    });
+    double batch_remove_ms = time_ms([&] { batched.remove_edges(doomed); });
+
+    std::cout << "  " << name << ": add_edge " << add_ms << " ms, add_edges " << batch_ms << " ms, " << queries
+              << " has_edge " << query_ms << " ms (" << hits << " hits), " << doomed.size() << " remove_edge "
+              << remove_ms << " ms, remove_edges " << batch_remove_ms << " ms\n";
+}
+
+int main() {
+    std::mt19937 rng(24);
+    std::vector<MayDSA::WeightedEdge<int>> edges;
+    for (int h = 0; h < hubs; ++h)
+        for (int i = 0; i < hub_degree; ++i) edges.push_back({h, static_cast<int>(rng() % (4 * hub_degree)), 1});
+    std::cout << hubs << " hubs x " << hub_degree << " arcs\n";
+    run<MayDSA::ListAdjacency>("list  ", edges);
+    run<MayDSA::SortedAdjacency>("sorted", edges);
+    run<MayDSA::HashAdjacency>("hash  ", edges);
+    return 0;
+}
@@ -0,0 +1,53 @@
+// Traversals on the mutable Graph vs its frozen CSRGraph snapshot
+// g++ -std=c++17 -O2 bench/graph_csr.cpp -o graph_csr
+#include "../include/graph.hpp"
+#include <chrono>
+#include <random>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    std::mt19937 rng(5);
+    for (int n : {100'000, 1'000'000}) {
+        const int avg_degree = 10;
+        MayDSA::Graph<int> g(true);
+        // Forward-only edges keep the graph acyclic so topological_sort/has_cycle do full passes
+        for (int i = 0; i < n; ++i) g.add_node(i);
+        for (long long e = 0; e < static_cast<long long>(n) * avg_degree; ++e) {
+            int u = static_cast<int>(rng() % (n - 1));
+            int v = u + 1 + static_cast<int>(rng() % (n - 1 - u));
+            g.add_edge(u, v);
+        }
+        const int missing = n;  // Isolated target forces a full traversal
+        g.add_node(missing);
+
+        MayDSA::CSRGraph<int> csr;
+        double freeze_ms = time_ms([&] { csr = g.freeze(); });
+        std::cout << "V=" << n << " E=" << csr.edge_count() << " (freeze " << freeze_ms << " ms)\n";
+
+        bool r1 = false, r2 = false;
+        double graph_bfs = time_ms([&] { r1 = g.bfs(0, missing); });
+        double csr_bfs = time_ms([&] { r2 = csr.bfs(0, missing); });
+        std::cout << "  bfs:              Graph " << graph_bfs << " ms, CSR " << csr_bfs << " ms" << (r1 == r2 ? "" : "  MISMATCH") << "\n";
+
+        double csr_dfs = time_ms([&] { r2 = csr.dfs(0, missing); });
+        double csr_cycle = time_ms([&] { r2 = csr.has_cycle(); });
+        double csr_topo = time_ms([&] { r2 = csr.topological_sort().size() == csr.vertex_count(); });
+        std::cout << "  CSR dfs " << csr_dfs << " ms, has_cycle " << csr_cycle << " ms, topological_sort " << csr_topo << " ms\n";
+
+        // The recursive Graph versions can overflow the stack on deep graphs; only run them on the small one
+        if (n <= 100'000) {
+            double graph_dfs = time_ms([&] { r1 = g.dfs(0, missing); });
+            double graph_cycle = time_ms([&] { r1 = g.has_cycle(); });
+            double graph_topo = time_ms([&] { r1 = g.topological_sort().size() == csr.vertex_count(); });
+            std::cout << "  Graph dfs " << graph_dfs << " ms, has_cycle " << graph_cycle << " ms, topological_sort " << graph_topo << " ms\n";
+        }
+    }
+    return 0;
+}
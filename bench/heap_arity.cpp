@@ -0,0 +1,77 @@
+// Heap arity sweep: D = 2/4/8, plain vs cache-aligned layout, int and 32-byte payloads
+// g++ -std=c++17 -O2 bench/heap_arity.cpp -o heap_arity
+#include "../include/heap.hpp"
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+struct Payload {
+    uint64_t key;
+    uint64_t extra[3];
+    bool operator<(const Payload& o) const { return key < o.key; }
+};
+
+template<typename T>
+T make(uint64_t k) {
+    if constexpr (std::is_same<T, Payload>::value) return Payload{k, {k, k, k}};
+    else return static_cast<T>(k);
+}
+
+template<typename T>
+uint64_t key_of(const T& v) {
+    if constexpr (std::is_same<T, Payload>::value) return v.key;
+    else return static_cast<uint64_t>(v);
+}
+
+// Scheduler-style hold model: fill to n, then pop the minimum and push a later key
+template<typename H>
+void run(const char* name, size_t n, size_t ops, const std::vector<uint32_t>& rnd) {
+    using T = std::decay_t<decltype(std::declval<H>().top())>;
+    H heap;
+    uint64_t sink = 0;
+    double ms = time_ms([&] {
+        for (size_t i = 0; i < n; ++i) heap.push(make<T>(rnd[i % rnd.size()]));
+        for (size_t i = 0; i < ops; ++i) {
+            uint64_t k = key_of(heap.top());
+            heap.pop();
+            heap.push(make<T>(k + rnd[i % rnd.size()]));
+        }
+        while (!heap.empty()) {
+            sink += key_of(heap.top());
+            heap.pop();
+        }
+    });
+    std::cout << name << " n=" << n << ": " << ms << " ms (" << sink % 10 << ")\n";
+}
+
+template<typename T>
+void sweep(const char* type, size_t n, size_t ops, const std::vector<uint32_t>& rnd) {
+    using L = std::less<T>;
+    std::cout << "-- " << type << "\n";
+    run<MayDSA::Heap<T, L, 2>>("D=2        ", n, ops, rnd);
+    run<MayDSA::Heap<T, L, 4>>("D=4        ", n, ops, rnd);
+    run<MayDSA::Heap<T, L, 8>>("D=8        ", n, ops, rnd);
+    run<MayDSA::Heap<T, L, 4, true>>("D=4 aligned", n, ops, rnd);
+    run<MayDSA::Heap<T, L, 8, true>>("D=8 aligned", n, ops, rnd);
+}
+
+int main() {
+    std::mt19937 rng(3);
+    std::vector<uint32_t> rnd(1 << 20);
+    for (auto& x : rnd) x = rng() % 1'000'000;
+
+    for (size_t n : {1'000, 100'000, 2'000'000}) {
+        sweep<uint32_t>("uint32_t", n, 2'000'000, rnd);
+        sweep<Payload>("32-byte payload", n, 2'000'000, rnd);
+    }
+    return 0;
+}
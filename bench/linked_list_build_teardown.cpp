@@ -0,0 +1,46 @@
+// Build + teardown of 10M nodes: pooled LinkedList vs std::forward_list / std::list
+// g++ -std=c++17 -O2 bench/linked_list_build_teardown.cpp -o linked_list_build_teardown
+#include "../include/linked_list.hpp"
+#include <chrono>
+#include <forward_list>
+#include <list>
+#include <memory_resource>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    const int n = 10'000'000;
+
+    double pooled = time_ms([&] {
+        MayDSA::LinkedList<int> list;
+        for (int i = 0; i < n; ++i) list.push_back(i);
+    });
+    std::cout << "LinkedList<int> (NodePool, default resource): " << pooled << " ms\n";
+
+    double mono = time_ms([&] {
+        std::pmr::monotonic_buffer_resource mr;
+        MayDSA::LinkedList<int> list(&mr);
+        for (int i = 0; i < n; ++i) list.push_back(i);
+    });
+    std::cout << "LinkedList<int> (NodePool, monotonic resource): " << mono << " ms\n";
+
+    double fwd = time_ms([&] {
+        std::forward_list<int> list;
+        auto it = list.before_begin();
+        for (int i = 0; i < n; ++i) it = list.insert_after(it, i);
+    });
+    std::cout << "std::forward_list<int>: " << fwd << " ms\n";
+
+    double dbl = time_ms([&] {
+        std::list<int> list;
+        for (int i = 0; i < n; ++i) list.push_back(i);
+    });
+    std::cout << "std::list<int>: " << dbl << " ms\n";
+    return 0;
+}
@@ -0,0 +1,41 @@
+// Minimum spanning forest: Kruskal vs Prim vs Boruvka across graph densities
+// g++ -std=c++17 -O2 -pthread bench/mst.cpp -o mst
+#include "../include/graph.hpp"
+#include <chrono>
+#include <random>
+#include <thread>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    std::mt19937 rng(17);
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t n = 200'000;
+    for (uint32_t avg_degree : {2u, 8u, 32u}) {
+        MayDSA::Graph<uint32_t> g(false);
+        for (uint64_t e = 0; e < uint64_t(n) * avg_degree / 2; ++e) {
+            g.add_edge(rng() % n, rng() % n, static_cast<int>(rng() % 100'000));
+        }
+        MayDSA::CSRGraph<uint32_t> csr = g.freeze();
+        std::cout << "V=" << csr.vertex_count() << " E=" << csr.edge_count() / 2 << "\n";
+
+        long long k1 = 0, kn = 0, p = 0, b1 = 0, bn = 0;
+        double k1_ms = time_ms([&] { k1 = csr.kruskal_mst(1).total_weight; });
+        double kn_ms = time_ms([&] { kn = csr.kruskal_mst(threads).total_weight; });
+        double p_ms = time_ms([&] { p = csr.prim_mst().total_weight; });
+        double b1_ms = time_ms([&] { b1 = csr.boruvka_mst(1).total_weight; });
+        double bn_ms = time_ms([&] { bn = csr.boruvka_mst(threads).total_weight; });
+        bool same = k1 == kn && kn == p && p == b1 && b1 == bn;
+        std::cout << "  kruskal x1 " << k1_ms << " ms, x" << threads << " " << kn_ms << " ms\n"
+                  << "  prim       " << p_ms << " ms\n"
+                  << "  boruvka x1 " << b1_ms << " ms, x" << threads << " " << bn_ms << " ms"
+                  << (same ? "" : "  MISMATCH") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+// SSSP-shaped workloads: RadixHeap vs comparison-based Heap
+// g++ -std=c++17 -O2 bench/radix_heap.cpp -o radix_heap
+#include "../include/heap.hpp"
+#include "../include/radix_heap.hpp"
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Road-like graph: side x side grid, 4-neighbour edges with random weights, in CSR form
+struct Grid {
+    std::vector<uint32_t> offsets, targets;
+    std::vector<int> weights;
+};
+
+Grid make_grid(uint32_t side, int max_w, std::mt19937& rng) {
+    Grid g;
+    uint32_t n = side * side;
+    g.offsets.push_back(0);
+    for (uint32_t v = 0; v < n; ++v) {
+        uint32_t r = v / side, c = v % side;
+        auto add = [&](uint32_t u) {
+            g.targets.push_back(u);
+            g.weights.push_back(1 + static_cast<int>(rng() % max_w));
+        };
+        if (r > 0) add(v - side);
+        if (r + 1 < side) add(v + side);
+        if (c > 0) add(v - 1);
+        if (c + 1 < side) add(v + 1);
+        g.offsets.push_back(static_cast<uint32_t>(g.targets.size()));
+    }
+    return g;
+}
+
+// Lazy-deletion Dijkstra; Push(d, v) / Pop() -> {d, v} adapt the queue under test
+template<typename Queue, typename Push, typename Pop>
+int64_t dijkstra(const Grid& g, Queue& q, Push push, Pop pop) {
+    size_t n = g.offsets.size() - 1;
+    std::vector<int> dist(n, std::numeric_limits<int>::max());
+    dist[0] = 0;
+    push(q, 0, 0u);
+    while (!q.empty()) {
+        auto [d, v] = pop(q);
+        if (d != dist[v]) continue;
+        for (uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            int nd = d + g.weights[e];
+            if (nd < dist[g.targets[e]]) {
+                dist[g.targets[e]] = nd;
+                push(q, nd, g.targets[e]);
+            }
+        }
+    }
+    int64_t total = 0;
+    for (int d : dist) total += d;
+    return total;
+}
+
+int main() {
+    std::mt19937 rng(21);
+    for (uint32_t side : {300u, 1000u, 2000u}) {
+        Grid g = make_grid(side, 1000, rng);
+
+        using Item = std::pair<int, uint32_t>;
+        MayDSA::Heap<Item> heap;
+        MayDSA::RadixHeap<int, uint32_t> radix;
+        int64_t a = 0, b = 0;
+
+        double heap_ms = time_ms([&] {
+            a = dijkstra(g, heap,
+                [](auto& q, int d, uint32_t v) { q.emplace(d, v); },
+                [](auto& q) { return q.pop_value(); });
+        });
+        double radix_ms = time_ms([&] {
+            b = dijkstra(g, radix,
+                [](auto& q, int d, uint32_t v) { q.push(d, v); },
+                [](auto& q) { return q.pop_value(); });
+        });
+        std::cout << "grid " << side << "x" << side << ": Heap<pair> " << heap_ms << " ms, RadixHeap "
+                  << radix_ms << " ms" << (a == b ? "" : "  MISMATCH") << "\n";
+
+        // Key-only replay of the same shape against MinHeap
+        std::vector<int> keys;
+        for (size_t i = 0; i < g.targets.size(); ++i) keys.push_back(g.weights[i]);
+        MayDSA::MinHeap min_heap;
+        MayDSA::RadixHeap<int, char> radix_keys;
+        int64_t sa = 0, sb = 0;
+        double min_ms = time_ms([&] {
+            int cur = 0;
+            min_heap.push(0);
+            for (size_t i = 0; !min_heap.empty(); ++i) {
+                cur = min_heap.pop_value();
+                sa += cur;
+                if (i < keys.size() / 2) {
+                    min_heap.push(cur + keys[2 * i]);
+                    min_heap.push(cur + keys[2 * i + 1]);
+                }
+            }
+        });
+        double rk_ms = time_ms([&] {
+            radix_keys.push(0, 0);
+            for (size_t i = 0; !radix_keys.empty(); ++i) {
+                int cur = radix_keys.pop_value().first;
+                sb += cur;
+                if (i < keys.size() / 2) {
+                    radix_keys.push(cur + keys[2 * i], 0);
+                    radix_keys.push(cur + keys[2 * i + 1], 0);
+                }
+            }
+        });
+        std::cout << "  key trace: MinHeap " << min_ms << " ms, RadixHeap " << rk_ms << " ms"
+                  << (sa == sb ? "" : "  MISMATCH") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+// SSSP on road-like grids: Graph::dijkstra vs CSRGraph::dijkstra vs parallel delta-stepping
+// g++ -std=c++17 -O2 -pthread bench/shortest_paths.cpp -o shortest_paths
+#include "../include/graph.hpp"
+#include <chrono>
+#include <random>
+#include <thread>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    std::mt19937 rng(13);
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int side : {300, 1000, 2000}) {
+        // side x side grid with random weights, like a road network
+        MayDSA::Graph<int> g(false);
+        for (int v = 0; v < side * side; ++v) {
+            int r = v / side, c = v % side;
+            if (r + 1 < side) g.add_edge(v, v + side, 1 + static_cast<int>(rng() % 1000));
+            if (c + 1 < side) g.add_edge(v, v + 1, 1 + static_cast<int>(rng() % 1000));
+        }
+        int far = side * side - 1;
+        std::cout << "grid " << side << "x" << side << "\n";
+
+        long long a = 0;
+        if (side <= 1000) {
+            double ms = time_ms([&] { a = g.dijkstra(0).distance.at(far); });
+            std::cout << "  Graph::dijkstra            " << ms << " ms\n";
+        }
+
+        MayDSA::CSRGraph<int> csr;
+        double freeze_ms = time_ms([&] { csr = g.freeze(); });
+        auto s = csr.id_of(0), t = csr.id_of(far);
+        long long b = 0, c = 0;
+        double dij_ms = time_ms([&] { b = csr.dijkstra(s).distance[t]; });
+        double early_ms = time_ms([&] { c = csr.dijkstra(s, csr.id_of(side + 1)).distance[csr.id_of(side + 1)]; });
+        std::cout << "  freeze " << freeze_ms << " ms, CSR dijkstra " << dij_ms << " ms, early exit (near target) "
+                  << early_ms << " ms (d=" << c << ")\n";
+        for (size_t th = 1; th <= max_threads; th *= 2) {
+            long long d = 0;
+            double ms = time_ms([&] { d = csr.delta_stepping(s, 0, th)[t]; });
+            std::cout << "  delta_stepping x" << th << "          " << ms << " ms" << (d == b ? "" : "  MISMATCH") << "\n";
+        }
+        if (side <= 1000 && a != b) std::cout << "  MISMATCH\n";
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Random positional edits: SkipList vs LinkedList vs UnrolledList
+// g++ -std=c++17 -O2 bench/skip_list.cpp -o skip_list
+#include "../include/linked_list.hpp"
+#include "../include/unrolled_list.hpp"
+#include "../include/skip_list.hpp"
+#include <chrono>
+#include <random>
+#include <set>
+#include <vector>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Alternate insert(pos) / remove(pos) at random positions on a list of n elements
+template<typename List>
+void run(const char* name, size_t n, const std::vector<uint64_t>& ops) {
+    List list;
+    for (size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i));
+    double ms = time_ms([&] {
+        for (size_t i = 0; i < ops.size(); ++i) {
+            if (i % 2 == 0) list.insert(ops[i] % (list.size() + 1), static_cast<int>(i));
+            else list.remove(ops[i] % list.size());
+        }
+    });
+    std::cout << name << " (n=" << n << "): " << ops.size() << " random edits " << ms << " ms\n";
+}
+
+int main() {
+    std::mt19937_64 rng(11);
+    std::vector<uint64_t> ops(20000);
+    for (auto& x : ops) x = rng();
+
+    for (size_t n : {10'000, 100'000, 500'000}) {
+        run<MayDSA::LinkedList<int>>("LinkedList<int>  ", n, ops);
+        run<MayDSA::UnrolledList<int>>("UnrolledList<int>", n, ops);
+        run<MayDSA::SkipList<int>>("SkipList<int>    ", n, ops);
+    }
+
+    // Ordered-set mode: O(log n) find vs std::set
+    const int m = 500'000;
+    MayDSA::SkipList<int> ordered(true);
+    std::set<int> ref;
+    for (int i = 0; i < m; ++i) {
+        int v = static_cast<int>(rng() % (4 * m));
+        ordered.insert(v);
+        ref.insert(v);
+    }
+    size_t hits = 0;
+    double skip_ms = time_ms([&] {
+        for (int i = 0; i < m; ++i) hits += ordered.contains(static_cast<int>(rng() % (4 * m)));
+    });
+    double set_ms = time_ms([&] {
+        for (int i = 0; i < m; ++i) hits += ref.count(static_cast<int>(rng() % (4 * m)));
+    });
+    std::cout << "ordered find x" << m << ": SkipList " << skip_ms << " ms, std::set " << set_ms
+              << " ms (hits " << hits << ")\n";
+    return 0;
+}
@@ -0,0 +1,51 @@
+// Heap allocations avoided by SmallVector<T, 8> vs Vector<T> on small, skewed sizes
+// g++ -std=c++17 -O2 bench/small_vector_allocs.cpp -o small_vector_allocs
+#include "../include/small_vector.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+static size_t g_allocs = 0;
+
+void* operator new(size_t n) {
+    ++g_allocs;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+template<typename Vec>
+void run(const char* name, const std::vector<int>& sizes) {
+    size_t before = g_allocs;
+    auto start = std::chrono::steady_clock::now();
+    long long checksum = 0;
+    for (int n : sizes) {
+        Vec v;
+        for (int i = 0; i < n; ++i) v.push_back(i);
+        checksum += v.size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << ": " << (g_allocs - before) << " allocations, "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+              << " (checksum " << checksum << ")\n";
+}
+
+int main() {
+    // Geometric sizes: mostly 0-7 elements (attribute lists, short paths), a long tail beyond
+    std::mt19937 rng(42);
+    std::geometric_distribution<int> dist(0.3);
+    std::vector<int> sizes(2'000'000);
+    size_t small = 0;
+    for (int& n : sizes) {
+        n = dist(rng);
+        small += n <= 8;
+    }
+    std::cout << "vectors: " << sizes.size() << ", with <= 8 elements: " << small << "\n";
+
+    run<MayDSA::Vector<int>>("Vector<int>", sizes);
+    run<MayDSA::SmallVector<int, 8>>("SmallVector<int, 8>", sizes);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// Traversal and positional-insert throughput: UnrolledList vs LinkedList
+// g++ -std=c++17 -O2 bench/unrolled_list.cpp -o unrolled_list
+#include "../include/linked_list.hpp"
+#include "../include/unrolled_list.hpp"
+#include <chrono>
+#include <random>
+#include <vector>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template<typename List>
+void run(const char* name, size_t n, const std::vector<size_t>& positions) {
+    List list;
+    // Interleave front/back pushes so node addresses are not in list order
+    for (size_t i = 0; i < n; ++i) {
+        if (i % 2) list.push_back(static_cast<int>(i));
+        else list.push_front(static_cast<int>(i));
+    }
+
+    // find() of an absent value walks the whole list
+    double traverse = time_ms([&] {
+        for (int rep = 0; rep < 10; ++rep)
+            if (static_cast<long long>(list.find(-1)) >= 0) std::cout << "unexpected\n";
+    });
+
+    double insert = time_ms([&] {
+        for (size_t pos : positions) list.insert(pos % (list.size() + 1), 7);
+    });
+
+    std::cout << name << ": 10 full traversals " << traverse << " ms, "
+              << positions.size() << " random inserts " << insert << " ms\n";
+}
+
+int main() {
+    const size_t n = 1'000'000;
+    std::mt19937_64 rng(7);
+    std::vector<size_t> positions(2000);
+    for (size_t& p : positions) p = rng();
+
+    run<MayDSA::LinkedList<int>>("LinkedList<int>", n, positions);
+    run<MayDSA::UnrolledList<int>>("UnrolledList<int> (64/block)", n, positions);
+    run<MayDSA::UnrolledList<int, 16>>("UnrolledList<int, 16>", n, positions);
+    return 0;
+}
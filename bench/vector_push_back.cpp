@@ -0,0 +1,37 @@
+// push_back throughput: MayDSA::Vector vs std::vector
+// g++ -std=c++17 -O2 bench/vector_push_back.cpp -o vector_push_back
+#include "../include/vector.hpp"
+#include <vector>
+#include <string>
+#include <chrono>
+
+template<typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template<typename T, typename Make>
+void run(const char* name, size_t n, Make make) {
+    double ours = time_ms([&] {
+        MayDSA::Vector<T> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(make(i));
+    });
+    double theirs = time_ms([&] {
+        std::vector<T> v;
+        for (size_t i = 0; i < n; ++i) v.push_back(make(i));
+    });
+    std::cout << name << " (n=" << n << "): MayDSA::Vector " << ours
+              << " ms, std::vector " << theirs << " ms\n";
+}
+
+int main() {
+    const size_t n = 10'000'000;
+    run<int>("int", n, [](size_t i) { return static_cast<int>(i); });
+    run<std::string>("std::string", n / 10, [](size_t i) {
+        return std::string("log-token-with-heap-payload-") + std::to_string(i);
+    });
+    return 0;
+}
@@ -0,0 +1,158 @@
+#pragma once
+#ifndef MAYDSA_CONCURRENT_HEAP_HPP
+#define MAYDSA_CONCURRENT_HEAP_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "heap.hpp"
+
+namespace MayDSA {
+
+/**
+ * @brief Relaxed concurrent priority queue (MultiQueue).
+ *
+ * Elements are spread over c * P sequential Heap shards, each behind its own
+ * mutex that is only ever try-locked on the fast path. push() drops the value
+ * into a random free shard; try_pop() samples `choices` random shards and
+ * removes the best of their tops. The result is close to, but not exactly,
+ * the global top: expected rank error grows with the shard count and shrinks
+ * with more choices. One shard (c * P == 1) gives a strict locked heap; more
+ * shards and fewer choices buy throughput.
+ */
+template<typename T, typename Compare = std::less<T>>
+class ConcurrentHeap {
+private:
+    struct alignas(64) Shard {
+        std::mutex lock;
+        std::atomic<size_t> count{0};  // Readable without the lock to skip empty shards
+        Heap<T, Compare> heap;
+    };
+
+    static constexpr size_t max_choices = 8;
+
+    std::vector<Shard> shards;
+    size_t choices;
+    Compare comp;
+
+    // Per-thread xorshift; quality only matters for spreading load
+    static uint64_t next_random() {
+        thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    Shard& random_shard() {
+        return shards[next_random() % shards.size()];
+    }
+
+    template<typename U>
+    void push_impl(U&& val) {
+        for (size_t attempt = 0;; ++attempt) {
+            Shard& s = random_shard();
+            // Stop spinning and wait once every shard has likely been tried
+            if (attempt < shards.size()) {
+                if (!s.lock.try_lock()) continue;
+            } else {
+                s.lock.lock();
+            }
+            s.heap.push(std::forward<U>(val));
+            s.count.store(s.heap.size(), std::memory_order_relaxed);
+            s.lock.unlock();
+            return;
+        }
+    }
+
+    static void take_top(Shard& s, T& out) {
+        out = s.heap.pop_value();
+        s.count.store(s.heap.size(), std::memory_order_relaxed);
+    }
+
+public:
+    /**
+     * @param threads Expected number of concurrent users (0 = hardware concurrency).
+     * @param per_thread Shards per thread (the c in c * P).
+     * @param pop_choices Shards compared per pop (at most 8); 1 is fastest, higher is closer to strict.
+     */
+    explicit ConcurrentHeap(size_t threads = 0, size_t per_thread = 2, size_t pop_choices = 2)
+        : choices(pop_choices) {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+        if (per_thread == 0 || pop_choices == 0) throw std::invalid_argument("ConcurrentHeap needs at least one shard and one choice");
+        shards = std::vector<Shard>(threads * per_thread);
+        if (choices > max_choices) choices = max_choices;
+        if (choices > shards.size()) choices = shards.size();
+    }
+
+    ConcurrentHeap(const ConcurrentHeap&) = delete;
+    ConcurrentHeap& operator=(const ConcurrentHeap&) = delete;
+
+    void push(const T& val) {
+        push_impl(val);
+    }
+
+    void push(T&& val) {
+        push_impl(std::move(val));
+    }
+
+    // Pop an element near the top into out; false only if every shard was seen empty
+    bool try_pop(T& out) {
+        Shard* held[max_choices];
+        size_t n_held = 0;
+        // A few sampling rounds, then fall back to a full sweep
+        for (size_t attempt = 0; attempt < 4 * choices; ++attempt) {
+            for (size_t i = 0; i < choices; ++i) {
+                Shard& s = random_shard();
+                if (s.count.load(std::memory_order_relaxed) == 0) continue;
+                bool dup = false;
+                for (size_t j = 0; j < n_held; ++j) dup |= held[j] == &s;
+                if (dup || !s.lock.try_lock()) continue;
+                if (s.heap.empty()) s.lock.unlock();
+                else held[n_held++] = &s;
+            }
+            if (n_held == 0) continue;
+
+            Shard* best = held[0];
+            for (size_t j = 1; j < n_held; ++j)
+                if (comp(held[j]->heap.top(), best->heap.top())) best = held[j];
+            take_top(*best, out);
+            for (size_t j = 0; j < n_held; ++j) held[j]->lock.unlock();
+            return true;
+        }
+
+        for (Shard& s : shards) {
+            std::lock_guard<std::mutex> guard(s.lock);
+            if (!s.heap.empty()) {
+                take_top(s, out);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Snapshot only; may be stale by the time it returns
+    size_t size() const {
+        size_t n = 0;
+        for (const Shard& s : shards) n += s.count.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t shard_count() const {
+        return shards.size();
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_CONCURRENT_HEAP_HPP
@@ -0,0 +1,148 @@
+#pragma once
+#ifndef MAYDSA_CONCURRENT_QUEUE_HPP
+#define MAYDSA_CONCURRENT_QUEUE_HPP
+
+#include <atomic>
+#include <new>
+#include <optional>
+#include <utility>
+#include "hazard_pointer.hpp"
+
+namespace MayDSA {
+
+/**
+ * @brief Unbounded lock-free MPMC FIFO queue (Michael & Scott).
+ *
+ * Singly linked nodes with a dummy head; popped nodes are reclaimed through
+ * hazard pointers, so any number of threads may push and pop concurrently.
+ * The destructor is not thread-safe and must run after all users are done.
+ */
+template<typename T>
+class ConcurrentQueue {
+private:
+    struct Node {
+        std::atomic<Node*> next;
+        std::optional<T> value;  // Empty for the dummy node
+        Node(): next(nullptr) {}
+        template<typename U>
+        explicit Node(U&& v): next(nullptr), value(std::forward<U>(v)) {}
+    };
+
+    alignas(64) std::atomic<Node*> head;
+    alignas(64) std::atomic<Node*> tail;
+
+    // Append the pre-linked chain first..last
+    void append(Node* first, Node* last) {
+        hazard::ThreadState& hp = hazard::local();
+        while (true) {
+            Node* t = hp.protect(0, tail);
+            Node* next = t->next.load(std::memory_order_acquire);
+            if (t != tail.load(std::memory_order_acquire)) continue;
+            if (next != nullptr) {
+                // Tail is lagging; help it along
+                tail.compare_exchange_weak(t, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (t->next.compare_exchange_weak(next, first, std::memory_order_release, std::memory_order_relaxed)) {
+                tail.compare_exchange_strong(t, last, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        }
+        hp.clear();
+    }
+
+public:
+    ConcurrentQueue() {
+        Node* dummy = new Node();
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    ~ConcurrentQueue() {
+        Node* curr = head.load(std::memory_order_relaxed);
+        while (curr) {
+            Node* next = curr->next.load(std::memory_order_relaxed);
+            delete curr;
+            curr = next;
+        }
+    }
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    // Enqueue a value; false only if the node could not be allocated
+    template<typename U>
+    bool try_push(U&& val) {
+        Node* n = new (std::nothrow) Node(std::forward<U>(val));
+        if (!n) return false;
+        append(n, n);
+        return true;
+    }
+
+    // Enqueue [first, last) with a single link operation
+    template<typename InputIt>
+    size_t try_push_batch(InputIt first, InputIt last) {
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        size_t n = 0;
+        for (; first != last; ++first, ++n) {
+            Node* node = new (std::nothrow) Node(*first);
+            if (!node) break;
+            if (chain_tail) chain_tail->next.store(node, std::memory_order_relaxed);
+            else chain_head = node;
+            chain_tail = node;
+        }
+        if (chain_head) append(chain_head, chain_tail);
+        return n;
+    }
+
+    // Dequeue into out; false if the queue was empty
+    bool try_pop(T& out) {
+        hazard::ThreadState& hp = hazard::local();
+        while (true) {
+            Node* h = hp.protect(0, head);
+            Node* t = tail.load(std::memory_order_acquire);
+            Node* next = h->next.load(std::memory_order_acquire);
+            hp.set(1, next);
+            if (h != head.load(std::memory_order_acquire)) continue;
+            if (next == nullptr) {
+                hp.clear();
+                return false;
+            }
+            if (h == t) {
+                tail.compare_exchange_weak(t, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(h, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // Only the winner touches next->value; next becomes the new dummy
+                out = std::move(*next->value);
+                next->value.reset();
+                hp.clear();
+                hp.retire(h);
+                return true;
+            }
+        }
+    }
+
+    // Dequeue up to max values into out; returns how many were taken
+    template<typename OutputIt>
+    size_t try_pop_batch(OutputIt out, size_t max) {
+        size_t n = 0;
+        T val;
+        while (n < max && try_pop(val)) {
+            *out++ = std::move(val);
+            ++n;
+        }
+        return n;
+    }
+
+    // Snapshot only; may be stale by the time it returns
+    bool empty() const {
+        Node* h = head.load(std::memory_order_acquire);
+        return h == tail.load(std::memory_order_acquire) && h->next.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_CONCURRENT_QUEUE_HPP
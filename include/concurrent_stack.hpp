@@ -0,0 +1,119 @@
+#pragma once
+#ifndef MAYDSA_CONCURRENT_STACK_HPP
+#define MAYDSA_CONCURRENT_STACK_HPP
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include "hazard_pointer.hpp"
+
+namespace MayDSA {
+
+/**
+ * @brief Unbounded lock-free MPMC LIFO stack (Treiber).
+ *
+ * Pops protect the head with a hazard pointer, which both prevents
+ * use-after-free and rules out ABA on the head CAS. The destructor is not
+ * thread-safe and must run after all users are done.
+ */
+template<typename T>
+class ConcurrentStack {
+private:
+    struct Node {
+        Node* next;  // Fixed once the node is published
+        T value;
+        template<typename U>
+        explicit Node(U&& v): next(nullptr), value(std::forward<U>(v)) {}
+    };
+
+    alignas(64) std::atomic<Node*> head;
+
+    // Publish the pre-linked chain first..last on top of the stack
+    void link(Node* first, Node* last) {
+        Node* h = head.load(std::memory_order_relaxed);
+        do {
+            last->next = h;
+        } while (!head.compare_exchange_weak(h, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+public:
+    ConcurrentStack(): head(nullptr) {}
+
+    ~ConcurrentStack() {
+        Node* curr = head.load(std::memory_order_relaxed);
+        while (curr) {
+            Node* next = curr->next;
+            delete curr;
+            curr = next;
+        }
+    }
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // Push a value; false only if the node could not be allocated
+    template<typename U>
+    bool try_push(U&& val) {
+        Node* n = new (std::nothrow) Node(std::forward<U>(val));
+        if (!n) return false;
+        link(n, n);
+        return true;
+    }
+
+    // Push [first, last) with a single CAS; the last element ends up on top
+    template<typename InputIt>
+    size_t try_push_batch(InputIt first, InputIt last) {
+        Node* top = nullptr;
+        Node* bottom = nullptr;
+        size_t n = 0;
+        for (; first != last; ++first, ++n) {
+            Node* node = new (std::nothrow) Node(*first);
+            if (!node) break;
+            node->next = top;
+            top = node;
+            if (!bottom) bottom = node;
+        }
+        if (top) link(top, bottom);
+        return n;
+    }
+
+    // Pop into out; false if the stack was empty
+    bool try_pop(T& out) {
+        hazard::ThreadState& hp = hazard::local();
+        while (true) {
+            Node* h = hp.protect(0, head);
+            if (!h) {
+                hp.clear();
+                return false;
+            }
+            Node* next = h->next;
+            if (head.compare_exchange_weak(h, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                out = std::move(h->value);
+                hp.clear();
+                hp.retire(h);
+                return true;
+            }
+        }
+    }
+
+    // Pop up to max values into out; returns how many were taken
+    template<typename OutputIt>
+    size_t try_pop_batch(OutputIt out, size_t max) {
+        size_t n = 0;
+        T val;
+        while (n < max && try_pop(val)) {
+            *out++ = std::move(val);
+            ++n;
+        }
+        return n;
+    }
+
+    // Snapshot only; may be stale by the time it returns
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_CONCURRENT_STACK_HPP
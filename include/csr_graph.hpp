@@ -0,0 +1,817 @@
+#pragma once
+#ifndef MAYDSA_CSR_GRAPH_HPP
+#define MAYDSA_CSR_GRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <iostream>
+#include <algorithm>
+#include <utility>
+#include <atomic>
+#include <thread>
+#include <tuple>
+#include "vector.hpp"
+#include "flat_hash_map.hpp"
+#include "heap.hpp"
+#include "dsu.hpp"
+#include "parallel.hpp"
+#include "graph_search.hpp"
+
+namespace MayDSA {
+
+namespace detail {
+
+// Fixed-size bit array used as a visited set over dense vertex ids
+class Bitset {
+private:
+    std::vector<uint64_t> words;
+
+public:
+    explicit Bitset(size_t n = 0) : words((n + 63) / 64, 0) {}
+
+    bool test(size_t i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void set(size_t i) {
+        words[i >> 6] |= uint64_t(1) << (i & 63);
+    }
+
+    void reset(size_t i) {
+        words[i >> 6] &= ~(uint64_t(1) << (i & 63));
+    }
+
+    // Set bit i and report whether it was already set
+    bool test_and_set(size_t i) {
+        uint64_t mask = uint64_t(1) << (i & 63);
+        bool was = words[i >> 6] & mask;
+        words[i >> 6] |= mask;
+        return was;
+    }
+};
+
+// Bitset whose bits may be set concurrently from several threads
+class AtomicBitset {
+private:
+    std::vector<std::atomic<uint64_t>> words;
+
+public:
+    explicit AtomicBitset(size_t n = 0) : words((n + 63) / 64) {
+        clear_words(0, words.size());
+    }
+
+    size_t word_count() const {
+        return words.size();
+    }
+
+    bool test(size_t i) const {
+        return (words[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1;
+    }
+
+    // Set bit i and report whether it was already set (exactly one caller sees false)
+    bool test_and_set(size_t i) {
+        uint64_t mask = uint64_t(1) << (i & 63);
+        if (words[i >> 6].load(std::memory_order_relaxed) & mask) return true;
+        return words[i >> 6].fetch_or(mask, std::memory_order_relaxed) & mask;
+    }
+
+    uint64_t word(size_t w) const {
+        return words[w].load(std::memory_order_relaxed);
+    }
+
+    void clear_words(size_t lo, size_t hi) {
+        for (size_t w = lo; w < hi; ++w) words[w].store(0, std::memory_order_relaxed);
+    }
+};
+
+} // namespace detail
+
+template<typename V>
+struct WeightedEdge {
+    V u;
+    V v;
+    int weight;
+};
+
+// Minimum spanning forest: one tree per connected component
+template<typename V>
+struct SpanningTree {
+    std::vector<WeightedEdge<V>> edges;
+    long long total_weight = 0;
+};
+
+/**
+ * @brief Immutable compressed-sparse-row snapshot of a Graph.
+ *
+ * Vertices are renumbered to dense ids 0..V-1 with a dictionary in both
+ * directions; the out-arcs of v are targets/weights[offsets[v], offsets[v+1]).
+ * Traversals work on ids and flat arrays only, so they touch no hash tables
+ * or list nodes and keep their visited state in bitsets. Undirected edges are
+ * stored as two arcs. Obtain one with Graph<T>::freeze().
+ */
+template<typename T>
+class CSRGraph {
+public:
+    using vertex_id = uint32_t;
+    using distance_type = int64_t;
+    static constexpr vertex_id npos = std::numeric_limits<vertex_id>::max();
+    static constexpr distance_type unreachable = std::numeric_limits<distance_type>::max();
+
+    // Indexed by vertex id; predecessor is npos for the source and unreached vertices
+    struct ShortestPaths {
+        std::vector<distance_type> distance;
+        std::vector<vertex_id> predecessor;
+    };
+
+    // order lists every vertex that could be sorted; cycle is empty for a DAG,
+    // otherwise one directed cycle in arc order (its last vertex links to its first)
+    struct TopologicalOrder {
+        std::vector<vertex_id> order;
+        std::vector<vertex_id> cycle;
+    };
+
+    // Indexed by vertex id; npos marks unreached vertices (and the root's parent)
+    struct BFSTree {
+        std::vector<uint32_t> distance;
+        std::vector<vertex_id> parent;
+    };
+
+private:
+    std::vector<T> names;              // id -> vertex
+    FlatHashMap<T, vertex_id> ids;     // vertex -> id
+    std::vector<uint64_t> offsets;     // V + 1 entries
+    std::vector<vertex_id> targets;
+    std::vector<int> weights;
+    bool directed;
+    int min_weight = 0;
+    int max_weight = 0;
+
+    // Exposes the arrays to detail::dfs_visit with dense per-vertex colors
+    struct SearchAdaptor {
+        using vertex = vertex_id;
+        using edge_iterator = uint64_t;
+
+        const CSRGraph& g;
+        std::vector<detail::Color> colors;
+
+        detail::Color color(vertex_id v) const { return colors[v]; }
+        void set_color(vertex_id v, detail::Color c) { colors[v] = c; }
+        std::pair<uint64_t, uint64_t> out_edges(vertex_id v) const { return {g.offsets[v], g.offsets[v + 1]}; }
+        const vertex_id& target(uint64_t e) const { return g.targets[e]; }
+        int weight(uint64_t e) const { return g.weights[e]; }
+    };
+
+    void check_sssp_source(vertex_id source) const;
+    void check_undirected() const;
+    // Each undirected edge once (u < v), self-loops dropped
+    std::vector<WeightedEdge<vertex_id>> undirected_edges() const;
+
+public:
+    CSRGraph(bool isDirected = false);
+
+    // Take ownership of ready-made CSR arrays; names[i] is the vertex with id i
+    CSRGraph(std::vector<T> names, std::vector<uint64_t> offsets, std::vector<vertex_id> targets,
+             std::vector<int> weights, bool isDirected);
+
+    size_t vertex_count() const { return names.size(); }
+    size_t edge_count() const { return targets.size(); }  // Stored arcs
+    bool is_directed() const { return directed; }
+
+    bool contains(const T& u) const { return ids.contains(u); }
+    vertex_id id_of(const T& u) const;
+    const T& vertex(vertex_id id) const { return names.at(id); }
+
+    size_t degree(vertex_id v) const { return offsets[v + 1] - offsets[v]; }
+    Span<const vertex_id> neighbors(vertex_id v) const;
+    Span<const int> weights_of(vertex_id v) const;
+
+    const std::vector<uint64_t>& row_offsets() const { return offsets; }
+    const std::vector<vertex_id>& column_targets() const { return targets; }
+    const std::vector<int>& edge_weights() const { return weights; }
+
+    bool has_edge(const T& u, const T& v) const;
+
+    bool dfs(const T& start, const T& target) const;
+    bool bfs(const T& start, const T& target) const;
+    std::vector<T> topological_sort() const;  // Throws std::logic_error on a cycle
+    TopologicalOrder topological_order() const;
+    bool has_cycle() const;
+
+    // Iterative DFS driven by a DFSVisitor, from root or from every unvisited vertex in id order
+    template<typename Visitor>
+    void depth_first(vertex_id root, Visitor& vis) const;
+    template<typename Visitor>
+    void depth_first(Visitor& vis) const;
+
+    /**
+     * @brief Level-synchronous parallel BFS returning hop distances and a parent tree.
+     *
+     * Direction-optimizing (Beamer et al.): levels run top-down, pushing from
+     * the frontier, until the frontier's edges outnumber the unexplored edges
+     * by a factor of 1/14; then they run bottom-up, with every unvisited vertex
+     * scanning its in-arcs for a parent in the frontier, until the frontier
+     * shrinks below V/24. Visited state is an atomic bitmap. Directed graphs
+     * build a transposed copy for the bottom-up steps.
+     *
+     * @param threads Worker threads to use (0 = hardware concurrency).
+     * @param max_depth Stop after this many levels (k-hop neighbourhoods).
+     */
+    BFSTree bfs_tree(vertex_id source, size_t threads = 1, uint32_t max_depth = npos) const;
+
+    /**
+     * @brief Sequential Dijkstra over a 4-ary Heap with lazy deletion.
+     *
+     * With a target, the search stops as soon as target is settled; entries
+     * for vertices not yet settled may then be upper bounds.
+     */
+    ShortestPaths dijkstra(vertex_id source, vertex_id target = npos) const;
+
+    /**
+     * @brief Parallel delta-stepping SSSP; returns distances only.
+     *
+     * Tentative distances are bucketed by width delta. All threads drain the
+     * current bucket together, relaxing light edges (w <= delta) until it stays
+     * empty, then relax the heavy edges of what it settled once. Buckets are
+     * thread-local and reused cyclically, so memory stays O(V + max_w / delta).
+     *
+     * @param delta Bucket width; 0 picks max weight / average degree.
+     * @param threads Worker threads to use (0 = hardware concurrency).
+     */
+    std::vector<distance_type> delta_stepping(vertex_id source, distance_type delta = 0, size_t threads = 1) const;
+
+    // Minimum spanning forests of an undirected graph; threads = 0 means hardware concurrency
+    SpanningTree<vertex_id> kruskal_mst(size_t threads = 1) const;
+    SpanningTree<vertex_id> prim_mst() const;
+    SpanningTree<vertex_id> boruvka_mst(size_t threads = 1) const;
+
+    void print() const;
+};
+
+template<typename T>
+CSRGraph<T>::CSRGraph(bool isDirected) : offsets(1, 0), directed(isDirected) {}
+
+template<typename T>
+CSRGraph<T>::CSRGraph(std::vector<T> names_, std::vector<uint64_t> offsets_, std::vector<vertex_id> targets_,
+                      std::vector<int> weights_, bool isDirected)
+    : names(std::move(names_)), ids(names.size()), offsets(std::move(offsets_)),
+      targets(std::move(targets_)), weights(std::move(weights_)), directed(isDirected) {
+    if (names.size() >= npos) throw std::length_error("Too many vertices for 32-bit ids");
+    if (offsets.size() != names.size() + 1 || offsets.back() != targets.size() || weights.size() != targets.size())
+        throw std::invalid_argument("Inconsistent CSR arrays");
+    for (vertex_id i = 0; i < names.size(); ++i) {
+        if (!ids.try_emplace(names[i], i).second) throw std::invalid_argument("Duplicate vertex in CSR dictionary");
+    }
+    if (!weights.empty()) {
+        auto [lo, hi] = std::minmax_element(weights.begin(), weights.end());
+        min_weight = *lo;
+        max_weight = *hi;
+    }
+}
+
+template<typename T>
+typename CSRGraph<T>::vertex_id CSRGraph<T>::id_of(const T& u) const {
+    auto it = ids.find(u);
+    if (it == ids.end()) throw std::out_of_range("Vertex not in graph");
+    return it->second;
+}
+
+template<typename T>
+Span<const typename CSRGraph<T>::vertex_id> CSRGraph<T>::neighbors(vertex_id v) const {
+    return Span<const vertex_id>(targets.data() + offsets[v], degree(v));
+}
+
+template<typename T>
+Span<const int> CSRGraph<T>::weights_of(vertex_id v) const {
+    return Span<const int>(weights.data() + offsets[v], degree(v));
+}
+
+template<typename T>
+bool CSRGraph<T>::has_edge(const T& u, const T& v) const {
+    auto iu = ids.find(u), iv = ids.find(v);
+    if (iu == ids.end() || iv == ids.end()) return false;
+    Span<const vertex_id> nbrs = neighbors(iu->second);
+    return std::find(nbrs.begin(), nbrs.end(), iv->second) != nbrs.end();
+}
+
+template<typename T>
+bool CSRGraph<T>::dfs(const T& start, const T& target) const {
+    if (!contains(start) || !contains(target)) return false;
+    vertex_id s = id_of(start), t = id_of(target);
+
+    detail::Bitset visited(vertex_count());
+    std::vector<vertex_id> stack{s};
+    visited.set(s);
+    while (!stack.empty()) {
+        vertex_id v = stack.back();
+        stack.pop_back();
+        if (v == t) return true;
+        for (vertex_id w : neighbors(v)) {
+            if (!visited.test_and_set(w)) stack.push_back(w);
+        }
+    }
+    return false;
+}
+
+template<typename T>
+bool CSRGraph<T>::bfs(const T& start, const T& target) const {
+    if (!contains(start) || !contains(target)) return false;
+    vertex_id s = id_of(start), t = id_of(target);
+
+    // The frontier vector doubles as the queue: [head, size) is pending
+    detail::Bitset visited(vertex_count());
+    std::vector<vertex_id> queue{s};
+    visited.set(s);
+    for (size_t head = 0; head < queue.size(); ++head) {
+        vertex_id v = queue[head];
+        if (v == t) return true;
+        for (vertex_id w : neighbors(v)) {
+            if (!visited.test_and_set(w)) queue.push_back(w);
+        }
+    }
+    return false;
+}
+
+template<typename T>
+template<typename Visitor>
+void CSRGraph<T>::depth_first(vertex_id root, Visitor& vis) const {
+    if (root >= vertex_count()) throw std::out_of_range("Vertex id out of range");
+    SearchAdaptor search{*this, std::vector<detail::Color>(vertex_count(), detail::Color::white)};
+    vis.start_vertex(root);
+    if (!vis.done()) detail::dfs_visit(search, root, vis);
+}
+
+template<typename T>
+template<typename Visitor>
+void CSRGraph<T>::depth_first(Visitor& vis) const {
+    SearchAdaptor search{*this, std::vector<detail::Color>(vertex_count(), detail::Color::white)};
+    for (vertex_id root = 0; root < vertex_count(); ++root) {
+        if (search.colors[root] != detail::Color::white) continue;
+        vis.start_vertex(root);
+        if (vis.done() || !detail::dfs_visit(search, root, vis)) return;
+    }
+}
+
+template<typename T>
+typename CSRGraph<T>::TopologicalOrder CSRGraph<T>::topological_order() const {
+    if (!directed) {
+        throw std::logic_error("Topological sort only applies to directed graphs.");
+    }
+
+    // Kahn: repeatedly emit vertices whose in-arcs have all been emitted
+    size_t n = vertex_count();
+    std::vector<uint32_t> indegree(n, 0);
+    for (vertex_id w : targets) ++indegree[w];
+
+    TopologicalOrder result;
+    std::vector<vertex_id>& order = result.order;
+    order.reserve(n);
+    for (vertex_id v = 0; v < n; ++v)
+        if (indegree[v] == 0) order.push_back(v);
+    for (size_t head = 0; head < order.size(); ++head) {
+        vertex_id u = order[head];
+        for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e)
+            if (--indegree[targets[e]] == 0) order.push_back(targets[e]);
+    }
+    if (order.size() == n) return result;
+
+    // Every leftover vertex has an in-arc from another leftover vertex, so
+    // walking those arcs backwards must revisit a vertex, which lies on a cycle
+    std::vector<vertex_id> pred(n, npos);
+    vertex_id start = npos;
+    for (vertex_id u = 0; u < n; ++u) {
+        if (indegree[u] == 0) continue;
+        start = u;
+        for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e)
+            if (indegree[targets[e]] != 0) pred[targets[e]] = u;
+    }
+    detail::Bitset seen(n);
+    vertex_id v = start;
+    while (!seen.test_and_set(v)) v = pred[v];
+    vertex_id u = v;
+    do {
+        result.cycle.push_back(u);
+        u = pred[u];
+    } while (u != v);
+    std::reverse(result.cycle.begin(), result.cycle.end());
+    return result;
+}
+
+template<typename T>
+std::vector<T> CSRGraph<T>::topological_sort() const {
+    TopologicalOrder sorted = topological_order();
+    if (!sorted.cycle.empty()) throw std::logic_error("Topological sort needs an acyclic graph.");
+    std::vector<T> result;
+    result.reserve(sorted.order.size());
+    for (vertex_id v : sorted.order) result.push_back(names[v]);
+    return result;
+}
+
+template<typename T>
+bool CSRGraph<T>::has_cycle() const {
+    detail::CycleVisitor<vertex_id> vis(directed);
+    depth_first(vis);
+    return vis.found;
+}
+
+template<typename T>
+typename CSRGraph<T>::BFSTree CSRGraph<T>::bfs_tree(vertex_id source, size_t threads, uint32_t max_depth) const {
+    if (source >= vertex_count()) throw std::out_of_range("Vertex id out of range");
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t n = vertex_count();
+    constexpr uint64_t alpha = 14, beta = 24;
+
+    // Bottom-up steps need in-arcs; for undirected graphs those are the out-arcs
+    std::vector<uint64_t> in_offsets;
+    std::vector<vertex_id> in_sources;
+    if (directed) {
+        in_offsets.assign(n + 1, 0);
+        for (vertex_id w : targets) ++in_offsets[w + 1];
+        for (size_t v = 0; v < n; ++v) in_offsets[v + 1] += in_offsets[v];
+        in_sources.resize(targets.size());
+        std::vector<uint64_t> fill(in_offsets.begin(), in_offsets.end() - 1);
+        for (vertex_id u = 0; u < n; ++u)
+            for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e) in_sources[fill[targets[e]]++] = u;
+    }
+    const std::vector<uint64_t>& rev_offsets = directed ? in_offsets : offsets;
+    const std::vector<vertex_id>& rev_sources = directed ? in_sources : targets;
+
+    BFSTree tree{std::vector<uint32_t>(n, npos), std::vector<vertex_id>(n, npos)};
+    detail::AtomicBitset visited(n), in_frontier(n);
+    visited.test_and_set(source);
+    tree.distance[source] = 0;
+
+    // Shared level state; written by thread 0 between barriers
+    std::vector<vertex_id> frontier{source};
+    std::vector<std::vector<vertex_id>> next(threads);
+    std::vector<uint64_t> next_edges(threads);
+    uint64_t unexplored = edge_count();
+    uint32_t level = 0;
+    bool bottom_up = false;
+    bool done = max_depth == 0;
+    detail::Barrier barrier(threads);
+
+    detail::run_threads(threads, [&](size_t t) {
+        auto range = [&](size_t total) {
+            return std::make_pair(total * t / threads, total * (t + 1) / threads);
+        };
+        while (!done) {
+            std::vector<vertex_id>& mine = next[t];
+            uint64_t edges = 0;
+            if (bottom_up) {
+                auto [wlo, whi] = range(in_frontier.word_count());
+                in_frontier.clear_words(wlo, whi);
+                barrier.wait();
+                auto [flo, fhi] = range(frontier.size());
+                for (size_t i = flo; i < fhi; ++i) in_frontier.test_and_set(frontier[i]);
+                barrier.wait();
+                // Whole 64-bit words per thread, so each vertex has a single owner
+                size_t vhi = std::min(n, whi * 64);
+                for (size_t v = wlo * 64; v < vhi; ++v) {
+                    if (visited.test(v)) continue;
+                    for (uint64_t e = rev_offsets[v]; e < rev_offsets[v + 1]; ++e) {
+                        vertex_id u = rev_sources[e];
+                        if (!in_frontier.test(u)) continue;
+                        visited.test_and_set(v);
+                        tree.distance[v] = level + 1;
+                        tree.parent[v] = u;
+                        mine.push_back(static_cast<vertex_id>(v));
+                        edges += degree(static_cast<vertex_id>(v));
+                        break;
+                    }
+                }
+            } else {
+                auto [flo, fhi] = range(frontier.size());
+                for (size_t i = flo; i < fhi; ++i) {
+                    vertex_id u = frontier[i];
+                    for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+                        vertex_id w = targets[e];
+                        if (visited.test_and_set(w)) continue;
+                        tree.distance[w] = level + 1;
+                        tree.parent[w] = u;
+                        mine.push_back(w);
+                        edges += degree(w);
+                    }
+                }
+            }
+            next_edges[t] = edges;
+            barrier.wait();
+
+            if (t == 0) {
+                size_t prev_size = frontier.size();
+                frontier.clear();
+                uint64_t frontier_edges = 0;
+                for (size_t i = 0; i < threads; ++i) {
+                    frontier.insert(frontier.end(), next[i].begin(), next[i].end());
+                    next[i].clear();
+                    frontier_edges += next_edges[i];
+                }
+                unexplored -= std::min(unexplored, frontier_edges);
+                if (!bottom_up && frontier_edges > unexplored / alpha) bottom_up = true;
+                else if (bottom_up && frontier.size() < prev_size && frontier.size() < n / beta) bottom_up = false;
+                ++level;
+                done = frontier.empty() || level >= max_depth;
+            }
+            barrier.wait();
+        }
+    });
+    return tree;
+}
+
+template<typename T>
+void CSRGraph<T>::check_sssp_source(vertex_id source) const {
+    if (source >= vertex_count()) throw std::out_of_range("Vertex id out of range");
+    if (min_weight < 0) throw std::invalid_argument("Shortest paths need non-negative edge weights");
+}
+
+template<typename T>
+typename CSRGraph<T>::ShortestPaths CSRGraph<T>::dijkstra(vertex_id source, vertex_id target) const {
+    check_sssp_source(source);
+    size_t n = vertex_count();
+    ShortestPaths result{std::vector<distance_type>(n, unreachable), std::vector<vertex_id>(n, npos)};
+    auto& dist = result.distance;
+    auto& pred = result.predecessor;
+
+    using Item = std::pair<distance_type, vertex_id>;
+    Heap<Item, std::less<Item>, 4> heap;
+    dist[source] = 0;
+    heap.emplace(0, source);
+    while (!heap.empty()) {
+        auto [d, v] = heap.pop_value();
+        if (d != dist[v]) continue;  // Superseded by a shorter entry
+        if (v == target) break;
+        for (uint64_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+            distance_type nd = d + weights[e];
+            vertex_id w = targets[e];
+            if (nd < dist[w]) {
+                dist[w] = nd;
+                pred[w] = v;
+                heap.emplace(nd, w);
+            }
+        }
+    }
+    return result;
+}
+
+template<typename T>
+std::vector<typename CSRGraph<T>::distance_type>
+CSRGraph<T>::delta_stepping(vertex_id source, distance_type delta, size_t threads) const {
+    check_sssp_source(source);
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t n = vertex_count();
+    if (delta <= 0) {
+        distance_type avg_degree = std::max<distance_type>(1, static_cast<distance_type>(edge_count() / std::max<size_t>(1, n)));
+        delta = std::max<distance_type>(1, max_weight / avg_degree);
+    }
+
+    std::vector<std::atomic<distance_type>> dist(n);
+    for (auto& d : dist) d.store(unreachable, std::memory_order_relaxed);
+    dist[source].store(0, std::memory_order_relaxed);
+
+    // Every pending distance lies in [current * delta, current * delta + delta + max_weight)
+    const size_t slots = static_cast<size_t>(max_weight / delta) + 2;
+    const size_t none = static_cast<size_t>(-1);
+    detail::Barrier barrier(threads);
+    std::vector<size_t> shared(threads);
+
+    // All threads call this in lockstep; each contributes one value
+    auto all_reduce = [&](size_t tid, size_t value, bool take_min) {
+        shared[tid] = value;
+        barrier.wait();
+        size_t r = take_min ? none : 0;
+        for (size_t x : shared) r = take_min ? std::min(r, x) : r + x;
+        barrier.wait();
+        return r;
+    };
+
+    detail::run_threads(threads, [&](size_t tid) {
+        std::vector<std::vector<vertex_id>> buckets(slots);
+        std::vector<vertex_id> frontier, settled;
+        if (tid == 0) buckets[0].push_back(source);
+
+        auto relax = [&](vertex_id v, distance_type d, bool light) {
+            for (uint64_t e = offsets[v]; e < offsets[v + 1]; ++e) {
+                if ((weights[e] <= delta) != light) continue;
+                distance_type nd = d + weights[e];
+                std::atomic<distance_type>& slot = dist[targets[e]];
+                distance_type cur = slot.load(std::memory_order_relaxed);
+                while (nd < cur) {
+                    if (slot.compare_exchange_weak(cur, nd, std::memory_order_relaxed)) {
+                        buckets[static_cast<size_t>(nd / delta) % slots].push_back(targets[e]);
+                        break;
+                    }
+                }
+            }
+        };
+
+        size_t current = 0;
+        while (true) {
+            size_t mine = none;
+            for (size_t k = 0; k < slots; ++k) {
+                if (!buckets[(current + k) % slots].empty()) {
+                    mine = current + k;
+                    break;
+                }
+            }
+            current = all_reduce(tid, mine, true);
+            if (current == none) break;
+
+            // Light edges can refill the current bucket; repeat until no thread has work
+            settled.clear();
+            while (true) {
+                frontier.clear();
+                std::swap(frontier, buckets[current % slots]);
+                if (all_reduce(tid, frontier.size(), false) == 0) break;
+                for (vertex_id v : frontier) {
+                    distance_type d = dist[v].load(std::memory_order_relaxed);
+                    if (static_cast<size_t>(d / delta) != current) continue;  // Stale entry
+                    settled.push_back(v);
+                    relax(v, d, true);
+                }
+            }
+
+            // Distances in this bucket are final now
+            for (vertex_id v : settled) relax(v, dist[v].load(std::memory_order_relaxed), false);
+        }
+    });
+
+    std::vector<distance_type> result(n);
+    for (size_t i = 0; i < n; ++i) result[i] = dist[i].load(std::memory_order_relaxed);
+    return result;
+}
+
+template<typename T>
+void CSRGraph<T>::check_undirected() const {
+    if (directed) throw std::logic_error("Minimum spanning tree only applies to undirected graphs.");
+}
+
+template<typename T>
+std::vector<WeightedEdge<typename CSRGraph<T>::vertex_id>> CSRGraph<T>::undirected_edges() const {
+    std::vector<WeightedEdge<vertex_id>> edges;
+    edges.reserve(edge_count() / 2);
+    for (vertex_id u = 0; u < vertex_count(); ++u) {
+        for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+            if (u < targets[e]) edges.push_back({u, targets[e], weights[e]});
+        }
+    }
+    return edges;
+}
+
+template<typename T>
+SpanningTree<typename CSRGraph<T>::vertex_id> CSRGraph<T>::kruskal_mst(size_t threads) const {
+    check_undirected();
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    auto edges = undirected_edges();
+    detail::parallel_sort(edges.begin(), edges.end(),
+                          [](const auto& a, const auto& b) { return a.weight < b.weight; }, threads);
+
+    DSU<vertex_id> dsu;
+    for (vertex_id v = 0; v < vertex_count(); ++v) dsu.make_set(v);
+
+    SpanningTree<vertex_id> tree;
+    for (const auto& e : edges) {
+        if (dsu.find(e.u) == dsu.find(e.v)) continue;
+        dsu.unite(e.u, e.v);
+        tree.edges.push_back(e);
+        tree.total_weight += e.weight;
+        if (tree.edges.size() + 1 == vertex_count()) break;
+    }
+    return tree;
+}
+
+template<typename T>
+SpanningTree<typename CSRGraph<T>::vertex_id> CSRGraph<T>::prim_mst() const {
+    check_undirected();
+
+    // Lazy Prim: (weight, to, from), stale entries skipped when popped
+    using Item = std::tuple<int, vertex_id, vertex_id>;
+    Heap<Item, std::less<Item>, 4> heap;
+    detail::Bitset in_tree(vertex_count());
+    SpanningTree<vertex_id> tree;
+
+    auto grow = [&](vertex_id u) {
+        for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+            if (!in_tree.test(targets[e])) heap.emplace(weights[e], targets[e], u);
+        }
+    };
+
+    for (vertex_id root = 0; root < vertex_count(); ++root) {
+        if (in_tree.test_and_set(root)) continue;
+        grow(root);
+        while (!heap.empty()) {
+            auto [w, to, from] = heap.pop_value();
+            if (in_tree.test_and_set(to)) continue;
+            tree.edges.push_back({from, to, w});
+            tree.total_weight += w;
+            grow(to);
+        }
+    }
+    return tree;
+}
+
+/**
+ * Each round, every component picks its cheapest incident edge in parallel
+ * (an atomic min over (weight, edge index) keys, so ties break consistently
+ * and the picks form a forest), the picks are hooked together, vertices are
+ * relabelled with their new component and edges inside a component are
+ * dropped. Components at least halve per round.
+ */
+template<typename T>
+SpanningTree<typename CSRGraph<T>::vertex_id> CSRGraph<T>::boruvka_mst(size_t threads) const {
+    check_undirected();
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t n = vertex_count();
+    auto edges = undirected_edges();
+    if (edges.size() >= (uint64_t(1) << 32)) throw std::length_error("Too many edges for Boruvka keys");
+
+    const uint64_t none = ~uint64_t(0);
+    auto key_of = [&](size_t i) {
+        // Flip the sign bit so negative weights order correctly as unsigned
+        uint64_t w = static_cast<uint32_t>(edges[i].weight) ^ 0x80000000u;
+        return (w << 32) | i;
+    };
+
+    std::vector<vertex_id> parent(n), comp(n);
+    for (vertex_id v = 0; v < n; ++v) parent[v] = comp[v] = v;
+    auto find = [&](vertex_id v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    };
+    std::vector<std::atomic<uint64_t>> best(n);
+    auto chunk = [&](size_t t, size_t total) {
+        return std::make_pair(total * t / threads, total * (t + 1) / threads);
+    };
+
+    SpanningTree<vertex_id> tree;
+    while (!edges.empty()) {
+        detail::run_threads(threads, [&](size_t t) {
+            auto [lo, hi] = chunk(t, n);
+            for (size_t v = lo; v < hi; ++v) best[v].store(none, std::memory_order_relaxed);
+        });
+        detail::run_threads(threads, [&](size_t t) {
+            auto [lo, hi] = chunk(t, edges.size());
+            for (size_t i = lo; i < hi; ++i) {
+                uint64_t key = key_of(i);
+                for (vertex_id c : {comp[edges[i].u], comp[edges[i].v]}) {
+                    uint64_t cur = best[c].load(std::memory_order_relaxed);
+                    while (key < cur && !best[c].compare_exchange_weak(cur, key, std::memory_order_relaxed)) {}
+                }
+            }
+        });
+
+        // Hooking is cheap (one pick per component), so it runs sequentially
+        size_t added = 0;
+        for (size_t c = 0; c < n; ++c) {
+            uint64_t key = best[c].load(std::memory_order_relaxed);
+            if (key == none) continue;
+            const auto& e = edges[key & 0xffffffffu];
+            vertex_id ru = find(e.u), rv = find(e.v);
+            if (ru == rv) continue;  // Both endpoints picked the same edge
+            parent[ru] = rv;
+            tree.edges.push_back(e);
+            tree.total_weight += e.weight;
+            ++added;
+        }
+        if (added == 0) break;
+
+        // Relabel with the new components, then drop edges that became internal
+        for (vertex_id v = 0; v < n; ++v) comp[v] = find(v);
+        std::vector<size_t> kept(threads);
+        detail::run_threads(threads, [&](size_t t) {
+            auto [lo, hi] = chunk(t, edges.size());
+            size_t out = lo;
+            for (size_t i = lo; i < hi; ++i)
+                if (comp[edges[i].u] != comp[edges[i].v]) edges[out++] = edges[i];
+            kept[t] = out - lo;
+        });
+        size_t out = 0;
+        for (size_t t = 0; t < threads; ++t) {
+            size_t lo = chunk(t, edges.size()).first;
+            std::move(edges.begin() + lo, edges.begin() + lo + kept[t], edges.begin() + out);
+            out += kept[t];
+        }
+        edges.resize(out);
+    }
+    return tree;
+}
+
+template<typename T>
+void CSRGraph<T>::print() const {
+    for (vertex_id u = 0; u < vertex_count(); ++u) {
+        std::cout << names[u] << " -> ";
+        for (uint64_t e = offsets[u]; e < offsets[u + 1]; ++e) {
+            std::cout << "(" << names[targets[e]] << ", " << weights[e] << ") ";
+        }
+        std::cout << "\n";
+    }
+}
+
+} // namespace MayDSA
+
+#endif // MAYDSA_CSR_GRAPH_HPP
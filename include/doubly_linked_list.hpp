@@ -0,0 +1,436 @@
+#ifndef MAYDSA_DOUBLY_LINKED_LIST_HPP
+#define MAYDSA_DOUBLY_LINKED_LIST_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+#include <memory_resource>
+#include <utility>
+
+namespace MayDSA{
+
+/**
+ * @brief Circular doubly linked list with a sentinel node.
+ *
+ * Every mutation at a known position (front, back or an iterator) is O(1).
+ * Nodes come from a std::pmr::memory_resource. splice() relinks nodes in
+ * O(1) when both lists use the same resource; otherwise it falls back to
+ * moving the elements across.
+ */
+template<typename T>
+class DoublyLinkedList {
+private:
+    struct NodeBase {
+        NodeBase* prev;
+        NodeBase* next;
+    };
+
+    struct Node : NodeBase {
+        T data;
+        template<typename... Args>
+        Node(Args&&... args): NodeBase{nullptr, nullptr}, data(std::forward<Args>(args)...) {}
+    };
+
+    NodeBase sentinel;  // sentinel.next is the head, sentinel.prev the tail
+    size_t length;
+    std::pmr::memory_resource* resource;
+
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    void destroy_node(NodeBase* node);
+
+    // Link node in front of pos
+    static void link_before(NodeBase* pos, NodeBase* node);
+    static void unlink(NodeBase* node);
+    // Move [first, last) in front of pos; the range must not contain pos
+    static void transfer(NodeBase* pos, NodeBase* first, NodeBase* last);
+
+    template<bool Const>
+    class Iter {
+        NodeBase* node;
+        friend class DoublyLinkedList;
+        friend class Iter<!Const>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+
+        Iter(): node(nullptr) {}
+        explicit Iter(NodeBase* n): node(n) {}
+
+        // iterator -> const_iterator
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        Iter(const Iter<false>& other): node(other.node) {}
+
+        reference operator*() const { return static_cast<Node*>(node)->data; }
+        pointer operator->() const { return &static_cast<Node*>(node)->data; }
+        Iter& operator++() { node = node->next; return *this; }
+        Iter operator++(int) { Iter tmp = *this; node = node->next; return tmp; }
+        Iter& operator--() { node = node->prev; return *this; }
+        Iter operator--(int) { Iter tmp = *this; node = node->prev; return tmp; }
+        bool operator==(const Iter& other) const { return node == other.node; }
+        bool operator!=(const Iter& other) const { return node != other.node; }
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // Constructor and destructor
+    explicit DoublyLinkedList(std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+    DoublyLinkedList(const DoublyLinkedList& other);
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
+    DoublyLinkedList& operator=(DoublyLinkedList other) noexcept;
+    ~DoublyLinkedList();
+
+    // Core operations (all O(1) except positional insert/remove by index)
+    void push_front(const T& val);
+    void push_front(T&& val);
+    void push_back(const T& val);
+    void push_back(T&& val);
+    template<typename... Args> T& emplace_front(Args&&... args);
+    template<typename... Args> T& emplace_back(Args&&... args);
+    void pop_front();
+    void pop_back();
+    void insert(size_t pos, const T& val);
+    void remove(size_t pos);
+    iterator insert(const_iterator pos, const T& val);
+    iterator insert(const_iterator pos, T&& val);
+    template<typename... Args> iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos);
+    void reverse();
+    void clear();
+
+    // Move nodes from other into this list, before pos. The whole-list and
+    // single-node forms are O(1); a range counts its nodes, O(distance).
+    // Between lists with different memory resources every form falls back
+    // to moving the elements one by one. Within one list, a pos at either
+    // edge of the range is a no-op and a pos inside it throws.
+    void splice(const_iterator pos, DoublyLinkedList& other);
+    void splice(const_iterator pos, DoublyLinkedList& other, const_iterator it);
+    void splice(const_iterator pos, DoublyLinkedList& other, const_iterator first, const_iterator last);
+
+    // Iterators
+    iterator begin() { return iterator(sentinel.next); }
+    iterator end() { return iterator(&sentinel); }
+    const_iterator begin() const { return const_iterator(sentinel.next); }
+    const_iterator end() const { return const_iterator(const_cast<NodeBase*>(&sentinel)); }
+
+    // Utility
+    T& front();
+    T& back();
+    size_t size() const;
+    bool empty() const;
+    size_t find(const T& val) const;
+    void print() const;
+    std::pmr::memory_resource* get_resource() const { return resource; }
+};
+
+template<typename T>
+template<typename... Args>
+typename MayDSA::DoublyLinkedList<T>::Node* MayDSA::DoublyLinkedList<T>::create_node(Args&&... args) {
+    void* p = resource->allocate(sizeof(Node), alignof(Node));
+    try {
+        return ::new (p) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        resource->deallocate(p, sizeof(Node), alignof(Node));
+        throw;
+    }
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::destroy_node(NodeBase* node) {
+    Node* n = static_cast<Node*>(node);
+    n->~Node();
+    resource->deallocate(n, sizeof(Node), alignof(Node));
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::link_before(NodeBase* pos, NodeBase* node) {
+    node->next = pos;
+    node->prev = pos->prev;
+    pos->prev->next = node;
+    pos->prev = node;
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::unlink(NodeBase* node) {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::transfer(NodeBase* pos, NodeBase* first, NodeBase* last) {
+    if (first == last || pos == last) return;
+    NodeBase* tail = last->prev;
+    // Detach [first, tail]
+    first->prev->next = last;
+    last->prev = first->prev;
+    // Reattach before pos
+    first->prev = pos->prev;
+    tail->next = pos;
+    pos->prev->next = first;
+    pos->prev = tail;
+}
+
+template<typename T>
+MayDSA::DoublyLinkedList<T>::DoublyLinkedList(std::pmr::memory_resource* mr)
+    : sentinel{&sentinel, &sentinel}, length(0), resource(mr) {}
+
+template<typename T>
+MayDSA::DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList& other)
+    : DoublyLinkedList(other.resource) {
+    for (const T& val : other) push_back(val);
+}
+
+template<typename T>
+MayDSA::DoublyLinkedList<T>::DoublyLinkedList(DoublyLinkedList&& other) noexcept
+    : DoublyLinkedList(other.resource) {
+    if (other.length == 0) return;
+    sentinel.next = other.sentinel.next;
+    sentinel.prev = other.sentinel.prev;
+    sentinel.next->prev = &sentinel;
+    sentinel.prev->next = &sentinel;
+    length = other.length;
+    other.sentinel.next = other.sentinel.prev = &other.sentinel;
+    other.length = 0;
+}
+
+template<typename T>
+MayDSA::DoublyLinkedList<T>& MayDSA::DoublyLinkedList<T>::operator=(DoublyLinkedList other) noexcept {
+    clear();
+    resource = other.resource;
+    transfer(&sentinel, other.sentinel.next, &other.sentinel);
+    length = other.length;
+    other.length = 0;
+    return *this;
+}
+
+template<typename T>
+MayDSA::DoublyLinkedList<T>::~DoublyLinkedList() {
+    clear();
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::clear() {
+    NodeBase* curr = sentinel.next;
+    while (curr != &sentinel) {
+        NodeBase* next = curr->next;
+        destroy_node(curr);
+        curr = next;
+    }
+    sentinel.next = sentinel.prev = &sentinel;
+    length = 0;
+}
+
+template<typename T>
+template<typename... Args>
+typename MayDSA::DoublyLinkedList<T>::iterator
+MayDSA::DoublyLinkedList<T>::emplace(const_iterator pos, Args&&... args) {
+    Node* node = create_node(std::forward<Args>(args)...);
+    link_before(pos.node, node);
+    ++length;
+    return iterator(node);
+}
+
+template<typename T>
+template<typename... Args>
+T& MayDSA::DoublyLinkedList<T>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template<typename T>
+template<typename... Args>
+T& MayDSA::DoublyLinkedList<T>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::push_front(const T& val) {
+    emplace_front(val);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::push_front(T&& val) {
+    emplace_front(std::move(val));
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::push_back(const T& val) {
+    emplace_back(val);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::push_back(T&& val) {
+    emplace_back(std::move(val));
+}
+
+template<typename T>
+typename MayDSA::DoublyLinkedList<T>::iterator
+MayDSA::DoublyLinkedList<T>::insert(const_iterator pos, const T& val) {
+    return emplace(pos, val);
+}
+
+template<typename T>
+typename MayDSA::DoublyLinkedList<T>::iterator
+MayDSA::DoublyLinkedList<T>::insert(const_iterator pos, T&& val) {
+    return emplace(pos, std::move(val));
+}
+
+template<typename T>
+typename MayDSA::DoublyLinkedList<T>::iterator
+MayDSA::DoublyLinkedList<T>::erase(const_iterator pos) {
+    if (pos.node == &sentinel) throw std::out_of_range("Cannot erase end()");
+    NodeBase* next = pos.node->next;
+    unlink(pos.node);
+    destroy_node(pos.node);
+    --length;
+    return iterator(next);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::pop_front() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    erase(begin());
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::pop_back() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    erase(const_iterator(sentinel.prev));
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::insert(size_t pos, const T& val) {
+    if (pos > length) throw std::out_of_range("Index out of range");
+    // Walk from whichever end is closer
+    NodeBase* curr;
+    if (pos <= length / 2) {
+        curr = sentinel.next;
+        for (size_t i = 0; i < pos; ++i) curr = curr->next;
+    } else {
+        curr = &sentinel;
+        for (size_t i = length; i > pos; --i) curr = curr->prev;
+    }
+    emplace(const_iterator(curr), val);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::remove(size_t pos) {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    NodeBase* curr;
+    if (pos <= length / 2) {
+        curr = sentinel.next;
+        for (size_t i = 0; i < pos; ++i) curr = curr->next;
+    } else {
+        curr = sentinel.prev;
+        for (size_t i = length - 1; i > pos; --i) curr = curr->prev;
+    }
+    erase(const_iterator(curr));
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::reverse() {
+    NodeBase* curr = &sentinel;
+    do {
+        std::swap(curr->prev, curr->next);
+        curr = curr->prev;  // old next
+    } while (curr != &sentinel);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::splice(const_iterator pos, DoublyLinkedList& other) {
+    if (&other == this || other.length == 0) return;
+    if (resource != other.resource) {
+        splice(pos, other, other.begin(), other.end());
+        return;
+    }
+    transfer(pos.node, other.begin().node, other.end().node);
+    length += other.length;
+    other.length = 0;
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::splice(const_iterator pos, DoublyLinkedList& other, const_iterator it) {
+    const_iterator last = it;
+    ++last;
+    if (&other == this && (pos == it || pos == last)) return;  // Already in place
+    splice(pos, other, it, last);
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::splice(const_iterator pos, DoublyLinkedList& other,
+                                         const_iterator first, const_iterator last) {
+    if (first == last) return;
+    if (&other == this) {
+        if (pos == first || pos == last) return;  // Already in place
+        for (const_iterator it = first; it != last; ++it) {
+            if (it == pos) throw std::invalid_argument("splice position lies inside the moved range");
+        }
+        transfer(pos.node, first.node, last.node);
+        return;
+    }
+    if (resource != other.resource) {
+        // Nodes cannot change resource: move the values and free the originals
+        while (first != last) {
+            emplace(pos, std::move(static_cast<Node*>(first.node)->data));
+            first = other.erase(first);
+        }
+        return;
+    }
+    size_t moved = 0;
+    for (const_iterator it = first; it != last; ++it) ++moved;
+    transfer(pos.node, first.node, last.node);
+    length += moved;
+    other.length -= moved;
+}
+
+template<typename T>
+T& MayDSA::DoublyLinkedList<T>::front() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    return static_cast<Node*>(sentinel.next)->data;
+}
+
+template<typename T>
+T& MayDSA::DoublyLinkedList<T>::back() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    return static_cast<Node*>(sentinel.prev)->data;
+}
+
+template<typename T>
+size_t MayDSA::DoublyLinkedList<T>::size() const {
+    return length;
+}
+
+template<typename T>
+bool MayDSA::DoublyLinkedList<T>::empty() const {
+    return length == 0;
+}
+
+template<typename T>
+size_t MayDSA::DoublyLinkedList<T>::find(const T& val) const {
+    size_t idx = 0;
+    for (const T& x : *this) {
+        if (x == val) return idx;
+        ++idx;
+    }
+    return npos; // not found
+}
+
+template<typename T>
+void MayDSA::DoublyLinkedList<T>::print() const {
+    std::cout << "[ ";
+    for (const T& x : *this) std::cout << x << " ";
+    std::cout << "]\n";
+}
+
+} // namespace MayDSA
+
+#endif
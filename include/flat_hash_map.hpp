@@ -0,0 +1,306 @@
+#pragma once
+#ifndef MAYDSA_FLAT_HASH_MAP_HPP
+#define MAYDSA_FLAT_HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <iostream>
+
+namespace MayDSA {
+
+/**
+ * @brief Open-addressing hash map with linear probing.
+ *
+ * Entries live in one flat array (no per-node allocation), the table size is
+ * a power of two, and erase uses backward-shift deletion so there are no
+ * tombstones. Any insertion may invalidate iterators and references.
+ *
+ * @tparam K Key type (hashable with Hash)
+ * @tparam V Mapped type
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    // Keys are stored mutable for relocation; never modify them through an iterator.
+    using value_type = std::pair<K, V>;
+
+private:
+    value_type* slots;  // Raw storage, constructed only where used[i] != 0
+    uint8_t* used;      // Occupancy flags
+    size_t capacity;    // Always 0 or a power of two
+    size_t count;       // Number of stored entries
+    unsigned shift;     // 64 - log2(capacity), for multiplicative hashing
+    Hash hasher;
+    KeyEqual key_eq;
+
+    // Fibonacci hashing spreads weak hashes (e.g. identity std::hash<int>)
+    size_t home(const K& key) const {
+        uint64_t h = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h >> shift);
+    }
+
+    // Slot holding key, or the empty slot where it would go
+    size_t probe(const K& key) const {
+        size_t mask = capacity - 1;
+        size_t i = home(key);
+        while (used[i] && !key_eq(slots[i].first, key)) i = (i + 1) & mask;
+        return i;
+    }
+
+    void rehash(size_t new_capacity) {
+        value_type* old_slots = slots;
+        uint8_t* old_used = used;
+        size_t old_capacity = capacity;
+
+        slots = static_cast<value_type*>(::operator new(new_capacity * sizeof(value_type)));
+        used = static_cast<uint8_t*>(std::calloc(new_capacity, 1));
+        if (!used) {
+            ::operator delete(static_cast<void*>(slots));
+            slots = old_slots;
+            used = old_used;
+            throw std::bad_alloc();
+        }
+        capacity = new_capacity;
+        shift = 64;
+        for (size_t c = new_capacity; c > 1; c >>= 1) --shift;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!old_used[i]) continue;
+            size_t j = probe(old_slots[i].first);
+            ::new (static_cast<void*>(slots + j)) value_type(std::move(old_slots[i]));
+            used[j] = 1;
+            old_slots[i].~value_type();
+        }
+        ::operator delete(static_cast<void*>(old_slots));
+        std::free(old_used);
+    }
+
+    // Keep load factor at or below 3/4
+    void grow_for(size_t n) {
+        if (n * 4 <= capacity * 3) return;
+        size_t new_capacity = capacity == 0 ? 16 : capacity;
+        while (n * 4 > new_capacity * 3) new_capacity *= 2;
+        rehash(new_capacity);
+    }
+
+    void release() {
+        clear();
+        ::operator delete(static_cast<void*>(slots));
+        std::free(used);
+        slots = nullptr;
+        used = nullptr;
+        capacity = 0;
+    }
+
+    template<bool Const>
+    class Iter {
+        using Map = std::conditional_t<Const, const FlatHashMap, FlatHashMap>;
+        Map* map;
+        size_t idx;
+
+        void skip() {
+            while (idx < map->capacity && !map->used[idx]) ++idx;
+        }
+
+    public:
+        using value_type = FlatHashMap::value_type;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        Iter(Map* m, size_t i) : map(m), idx(i) { skip(); }
+
+        // iterator -> const_iterator
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        Iter(const Iter<false>& other) : map(other.map), idx(other.idx) {}
+
+        reference operator*() const { return map->slots[idx]; }
+        pointer operator->() const { return map->slots + idx; }
+        Iter& operator++() { ++idx; skip(); return *this; }
+        Iter operator++(int) { Iter tmp = *this; ++*this; return tmp; }
+        bool operator==(const Iter& other) const { return idx == other.idx; }
+        bool operator!=(const Iter& other) const { return idx != other.idx; }
+
+        friend class FlatHashMap;
+        friend class Iter<!Const>;
+    };
+
+public:
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    FlatHashMap() : slots(nullptr), used(nullptr), capacity(0), count(0), shift(64) {}
+
+    explicit FlatHashMap(size_t expected) : FlatHashMap() {
+        reserve(expected);
+    }
+
+    ~FlatHashMap() {
+        release();
+    }
+
+    FlatHashMap(const FlatHashMap& other) : FlatHashMap() {
+        hasher = other.hasher;
+        key_eq = other.key_eq;
+        reserve(other.count);
+        for (const auto& kv : other) emplace(kv.first, kv.second);
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : slots(other.slots), used(other.used), capacity(other.capacity), count(other.count),
+          shift(other.shift), hasher(std::move(other.hasher)), key_eq(std::move(other.key_eq)) {
+        other.slots = nullptr;
+        other.used = nullptr;
+        other.capacity = 0;
+        other.count = 0;
+        other.shift = 64;
+    }
+
+    FlatHashMap& operator=(FlatHashMap other) noexcept {
+        std::swap(slots, other.slots);
+        std::swap(used, other.used);
+        std::swap(capacity, other.capacity);
+        std::swap(count, other.count);
+        std::swap(shift, other.shift);
+        std::swap(hasher, other.hasher);
+        std::swap(key_eq, other.key_eq);
+        return *this;
+    }
+
+    // Insert (key, V(args...)) if key is absent; returns the entry and whether it was inserted
+    template<typename Key, typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        if (capacity) {
+            size_t i = probe(key);
+            if (used[i]) return {iterator(this, i), false};
+        }
+        grow_for(count + 1);
+        size_t i = probe(key);
+        ::new (static_cast<void*>(slots + i)) value_type(std::piecewise_construct,
+            std::forward_as_tuple(std::forward<Key>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        used[i] = 1;
+        ++count;
+        return {iterator(this, i), true};
+    }
+
+    template<typename Key, typename Val>
+    std::pair<iterator, bool> emplace(Key&& key, Val&& val) {
+        return try_emplace(std::forward<Key>(key), std::forward<Val>(val));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& kv) {
+        return try_emplace(kv.first, kv.second);
+    }
+
+    V& operator[](const K& key) {
+        return try_emplace(key).first->second;
+    }
+
+    V& operator[](K&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    V& at(const K& key) {
+        auto it = find(key);
+        if (it == end()) throw std::out_of_range("Key not found");
+        return it->second;
+    }
+
+    const V& at(const K& key) const {
+        auto it = find(key);
+        if (it == end()) throw std::out_of_range("Key not found");
+        return it->second;
+    }
+
+    iterator find(const K& key) {
+        if (count == 0) return end();
+        size_t i = probe(key);
+        return used[i] ? iterator(this, i) : end();
+    }
+
+    const_iterator find(const K& key) const {
+        if (count == 0) return end();
+        size_t i = probe(key);
+        return used[i] ? const_iterator(this, i) : end();
+    }
+
+    bool contains(const K& key) const {
+        return find(key) != end();
+    }
+
+    // Remove key if present; returns number of entries removed (0 or 1)
+    size_t erase(const K& key) {
+        if (count == 0) return 0;
+        size_t mask = capacity - 1;
+        size_t i = probe(key);
+        if (!used[i]) return 0;
+        slots[i].~value_type();
+        used[i] = 0;
+        --count;
+
+        // Backward-shift the following cluster so lookups never hit a gap
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (!used[j]) break;
+            size_t h = home(slots[j].first);
+            if (((j - h) & mask) >= ((j - i) & mask)) {
+                ::new (static_cast<void*>(slots + i)) value_type(std::move(slots[j]));
+                used[i] = 1;
+                slots[j].~value_type();
+                used[j] = 0;
+                i = j;
+            }
+        }
+        return 1;
+    }
+
+    // Make room for n entries without rehashing
+    void reserve(size_t n) {
+        grow_for(n);
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < capacity; ++i) {
+            if (used[i]) {
+                slots[i].~value_type();
+                used[i] = 0;
+            }
+        }
+        count = 0;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity); }
+
+    void print() const {
+        std::cout << "{ ";
+        for (const auto& [k, v] : *this) std::cout << k << ": " << v << " ";
+        std::cout << "}\n";
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_FLAT_HASH_MAP_HPP
@@ -0,0 +1,125 @@
+#pragma once
+#ifndef MAYDSA_FREQUENCY_HPP
+#define MAYDSA_FREQUENCY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "flat_hash_map.hpp"
+#include "simd.hpp"
+
+namespace MayDSA {
+
+template<typename T>
+using FreqMap = FlatHashMap<T, size_t>;
+
+namespace detail {
+
+// Integer key ranges up to this many slots (or ~2 slots per element) are counted in a flat array
+constexpr uint64_t dense_count_limit = uint64_t(1) << 22;
+
+template<typename T>
+FreqMap<T> count_hashed(const T* p, size_t n) {
+    FreqMap<T> mp;
+    for (size_t i = 0; i < n; ++i) mp[p[i]]++;
+    return mp;
+}
+
+template<typename T>
+FreqMap<T> count_dense(const T* p, size_t n, T lo, uint64_t range, size_t threads) {
+    // Each extra thread needs its own range-sized array, and the merge walks
+    // all of them: keep threads * range within about max(n, dense_count_limit)
+    uint64_t budget = std::max<uint64_t>(dense_count_limit, n);
+    threads = static_cast<size_t>(std::min<uint64_t>(threads, std::max<uint64_t>(1, budget / range)));
+
+    std::vector<size_t> counts(range, 0);
+    if (threads <= 1) {
+        for (size_t i = 0; i < n; ++i)
+            counts[static_cast<uint64_t>(p[i]) - static_cast<uint64_t>(lo)]++;
+    } else {
+        // Thread 0 counts into counts itself; the others into private arrays
+        std::vector<std::vector<size_t>> local(threads - 1, std::vector<size_t>(range, 0));
+        auto run = [&](auto&& body) {
+            std::vector<std::thread> pool;
+            for (size_t t = 0; t < threads; ++t) pool.emplace_back(body, t);
+            for (auto& th : pool) th.join();
+        };
+        size_t chunk = (n + threads - 1) / threads;
+        run([&](size_t t) {
+            size_t begin = std::min(n, t * chunk), end = std::min(n, begin + chunk);
+            std::vector<size_t>& c = t == 0 ? counts : local[t - 1];
+            for (size_t i = begin; i < end; ++i)
+                c[static_cast<uint64_t>(p[i]) - static_cast<uint64_t>(lo)]++;
+        });
+        // Merge in parallel: each thread sums one slice of the key range
+        uint64_t slice = (range + threads - 1) / threads;
+        run([&](size_t t) {
+            uint64_t begin = std::min<uint64_t>(range, t * slice), end = std::min<uint64_t>(range, begin + slice);
+            for (const auto& c : local)
+                for (uint64_t k = begin; k < end; ++k) counts[k] += c[k];
+        });
+    }
+
+    size_t distinct = 0;
+    for (size_t c : counts) distinct += c != 0;
+    FreqMap<T> mp(distinct);
+    for (uint64_t k = 0; k < range; ++k)
+        if (counts[k]) mp.try_emplace(static_cast<T>(static_cast<uint64_t>(lo) + k), counts[k]);
+    return mp;
+}
+
+} // namespace detail
+
+/**
+ * @brief Count occurrences of each distinct value in p[0, n).
+ *
+ * Integral keys with a small value range are tallied in a dense array;
+ * everything else goes through a FlatHashMap. With threads > 1 each thread
+ * counts its own chunk and the partial results are merged at the end.
+ *
+ * @param threads Worker threads to use (0 = hardware concurrency)
+ */
+template<typename T>
+FreqMap<T> frequency_count(const T* p, size_t n, size_t threads = 1) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    // Not worth spawning threads for small inputs
+    threads = std::max<size_t>(1, std::min(threads, n / 65536));
+
+    if constexpr (std::is_integral<T>::value && !std::is_same<T, bool>::value) {
+        if (n > 0) {
+            T lo = simd::min(p, n), hi = simd::max(p, n);
+            uint64_t range = static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1;
+            if (range != 0 && range <= std::min<uint64_t>(detail::dense_count_limit, 2 * uint64_t(n) + 1024))
+                return detail::count_dense(p, n, lo, range, threads);
+        }
+    }
+
+    if (threads <= 1) return detail::count_hashed(p, n);
+
+    std::vector<FreqMap<T>> local(threads);
+    std::vector<std::thread> pool;
+    size_t chunk = (n + threads - 1) / threads;
+    for (size_t t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            size_t begin = std::min(n, t * chunk), end = std::min(n, begin + chunk);
+            local[t] = detail::count_hashed(p + begin, end - begin);
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    // Merge the smaller maps into the largest
+    auto largest = std::max_element(local.begin(), local.end(),
+        [](const FreqMap<T>& a, const FreqMap<T>& b) { return a.size() < b.size(); });
+    FreqMap<T> result = std::move(*largest);
+    for (auto& part : local) {
+        for (auto& [k, c] : part) result[std::move(k)] += c;
+    }
+    return result;
+}
+
+} // namespace MayDSA
+
+#endif // MAYDSA_FREQUENCY_HPP
@@ -6,20 +6,81 @@
 #include <iostream>
 #include <stdexcept>
 #include<fstream>
+#include <queue>
+#include <functional>
+#include <optional>
+#include <algorithm>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include "heap.hpp"
+#include "csr_graph.hpp"
+#include "graph_adjacency.hpp"
 
 namespace MayDSA {
 
+// Result of Graph<T>::dijkstra; only reached vertices have entries
 template<typename T>
+struct ShortestPaths {
+    std::unordered_map<T, long long> distance;
+    std::unordered_map<T, T> predecessor;  // No entry for the source
+
+    // Vertices from the source to target, empty if target was not reached
+    std::vector<T> path_to(const T& target) const {
+        std::vector<T> path;
+        if (!distance.count(target)) return path;
+        path.push_back(target);
+        for (auto it = predecessor.find(target); it != predecessor.end(); it = predecessor.find(it->second)) {
+            path.push_back(it->second);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+// Result of Graph<T>::topological_order; cycle is empty for a DAG, otherwise
+// one directed cycle in edge order (its last vertex links back to its first)
+template<typename T>
+struct TopologicalOrder {
+    std::vector<T> order;
+    std::vector<T> cycle;
+};
+
+// Result of Graph<T>::bfs_tree; only reached vertices have entries
+template<typename T>
+struct BFSTree {
+    std::unordered_map<T, size_t> distance;  // Hops from the start
+    std::unordered_map<T, T> parent;         // No entry for the start
+};
+
+/**
+ * @brief Weighted graph over hashable vertex labels.
+ *
+ * @tparam Adjacency Per-vertex edge container: ListAdjacency (default, keeps
+ * parallel edges), SortedAdjacency or HashAdjacency (one edge per pair with
+ * O(log d) / O(1) has_edge and remove_edge). See graph_adjacency.hpp.
+ */
+template<typename T, typename Adjacency = ListAdjacency>
 class Graph {
 private:
-    std::unordered_map<T, std::list<std::pair<T, int>>> adj;
+    using Edges = typename Adjacency::template edges<T>;
+
+    std::unordered_map<T, Edges> adj;
     bool directed;
+    std::optional<detail::IncrementalOrder<T>> order;  // Engaged by track_topological_order()
 
 public:
     Graph(bool isDirected = false);
 
+    // With ListAdjacency repeated calls add parallel edges; the other policies update the weight.
+    // While the topological order is tracked, throws std::logic_error if the edge would close a cycle.
     void add_edge(const T& u, const T& v, int weight = 1);
+    // Directed only: add the edge unless it would close a cycle, and report which happened
+    bool try_add_edge(const T& u, const T& v, int weight = 1);
     void remove_edge(const T& u, const T& v);
+    // Bulk versions: arcs are grouped per source vertex and applied in one container call each
+    void add_edges(const std::vector<WeightedEdge<T>>& edges);
+    void remove_edges(const std::vector<std::pair<T, T>>& edges);
     void add_node(const T& u);
     void remove_node(const T& u);
 
@@ -30,58 +91,202 @@ public:
 
     bool dfs(const T& start, const T& target) const;
     bool bfs(const T& start, const T& target) const;
-    std::vector<T> topological_sort() const;
+    std::vector<T> topological_sort() const;  // Throws std::logic_error on a cycle
+    TopologicalOrder<T> topological_order() const;
     bool has_cycle() const;
+
+    /**
+     * @brief Maintain a topological order online instead of recomputing it (directed only).
+     *
+     * Throws std::logic_error if the graph is undirected or already has a
+     * cycle. While on, every add_edge runs a search bounded by the part of
+     * the order it disturbs (see detail::IncrementalOrder) and cycle-closing
+     * edges are refused, so has_cycle() is O(1) and topological_sort() just
+     * reads the order in O(V). Edge removals never invalidate the order.
+     * add_edges applies edges one at a time in this mode, so the edges
+     * before a refused one stay added.
+     */
+    void track_topological_order(bool on = true);
+    bool tracks_topological_order() const { return order.has_value(); }
+
+    // Iterative DFS driven by a DFSVisitor, from root or from every unvisited vertex
+    template<typename Visitor>
+    void depth_first(const T& root, Visitor& vis) const;
+    template<typename Visitor>
+    void depth_first(Visitor& vis) const;
+
+    // Hop distances and BFS parent tree from start (parallel, runs on a frozen snapshot)
+    BFSTree<T> bfs_tree(const T& start, size_t threads = 1) const;
+
+    // Minimum spanning forests (undirected only); each runs on a frozen snapshot
+    SpanningTree<T> kruskal_mst(size_t threads = 1) const;
+    SpanningTree<T> prim_mst() const;
+    SpanningTree<T> boruvka_mst(size_t threads = 1) const;
+
+    // Single-source shortest paths (non-negative weights); stops early once target is settled
+    ShortestPaths<T> dijkstra(const T& source) const;
+    ShortestPaths<T> dijkstra(const T& source, const T& target) const;
+
+    // Stream the graph in Graphviz DOT format; each undirected edge is written once
+    void write_dot(std::ostream& out) const;
     void export_dot(const std::string& filename) const; // for visulization
     void export_png(const std::string& png_filename) const;
+
+    // Immutable CSR copy for read-heavy traversals; later edits are not reflected
+    CSRGraph<T> freeze() const;
+
+private:
+    // Exposes the adjacency lists to detail::dfs_visit; colors live in a flat hash map
+    struct SearchAdaptor {
+        using vertex = T;
+        using edge_iterator = typename Edges::const_iterator;
+
+        const Graph& g;
+        FlatHashMap<T, detail::Color> colors;
+
+        detail::Color color(const T& v) const {
+            auto it = colors.find(v);
+            return it == colors.end() ? detail::Color::white : it->second;
+        }
+        void set_color(const T& v, detail::Color c) { colors[v] = c; }
+        std::pair<edge_iterator, edge_iterator> out_edges(const T& v) const {
+            const Edges& edges = g.adj.at(v);
+            return {edges.begin(), edges.end()};
+        }
+        const T& target(edge_iterator e) const { return e->first; }
+        int weight(edge_iterator e) const { return e->second; }
+    };
+
+    ShortestPaths<T> dijkstra_impl(const T& source, const T* target) const;
+    static SpanningTree<T> to_vertices(const CSRGraph<T>& csr, const SpanningTree<uint32_t>& tree);
 };
 
 
 
 
 
-template<typename T>
-Graph<T>::Graph(bool isDirected) : directed(isDirected) {}
+template<typename T, typename Adjacency>
+Graph<T, Adjacency>::Graph(bool isDirected) : directed(isDirected) {}
 
-template<typename T>
-void Graph<T>::add_node(const T& u) {
-    if (adj.count(u) == 0) {
-        adj[u] = {};
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::add_node(const T& u) {
+    if (adj.try_emplace(u).second && order) order->push_back(u);
+}
+
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::add_edge(const T& u, const T& v, int weight) {
+    if (order) {
+        if (!try_add_edge(u, v, weight)) throw std::logic_error("Edge would create a cycle");
+        return;
+    }
+    adj[u].insert(v, weight);
+    Edges& back = adj[v];  // Creates v when it is new
+    if (!directed) {
+        back.insert(u, weight);
     }
 }
 
-template<typename T>
-void Graph<T>::add_edge(const T& u, const T& v, int weight) {
-    add_node(u);
-    add_node(v);
-    adj[u].push_back({v, weight});
+template<typename T, typename Adjacency>
+bool Graph<T, Adjacency>::try_add_edge(const T& u, const T& v, int weight) {
     if (!directed) {
-        adj[v].push_back({u, weight});
+        throw std::logic_error("Cycle-checked insertion only applies to directed graphs.");
+    }
+    if (u == v) return false;
+
+    bool new_u = !adj.count(u), new_v = !adj.count(v);
+    if (!order) {
+        if (!new_u && !new_v && dfs(v, u)) return false;
+    } else if (!new_u && !new_v) {
+        auto out = [this](const T& w) -> const Edges& { return adj.at(w); };
+        if (!order->insert_arc(u, v, out)) return false;
+    } else {
+        // A fresh vertex closes no cycle; a fresh source has no in-edges, so it can go first
+        if (new_v) order->push_back(v);
+        if (new_u) order->push_front(u);
     }
+    adj[u].insert(v, weight);
+    adj.try_emplace(v);
+    return true;
 }
 
-template<typename T>
-void Graph<T>::remove_edge(const T& u, const T& v) {
-    if (adj.count(u)) {
-        adj[u].remove_if([&](const std::pair<T, int>& p) { return p.first == v; });
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::remove_edge(const T& u, const T& v) {
+    auto it = adj.find(u);
+    if (it != adj.end()) {
+        it->second.erase(v);
     }
-    if (!directed && adj.count(v)) {
-        adj[v].remove_if([&](const std::pair<T, int>& p) { return p.first == u; });
+    if (!directed && (it = adj.find(v)) != adj.end()) {
+        it->second.erase(u);
     }
 }
 
-template<typename T>
-bool Graph<T>::has_edge(const T& u, const T& v) const {
-    if (adj.count(u)) {
-        for (const auto& neighbor : adj.at(u)) {
-            if (neighbor.first == v) return true;
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::add_edges(const std::vector<WeightedEdge<T>>& edges) {
+    if (order) {
+        for (const WeightedEdge<T>& e : edges) add_edge(e.u, e.v, e.weight);
+        return;
+    }
+    // Group arcs by source so each container sees one insert_range
+    FlatHashMap<T, size_t> group_of(edges.size());
+    std::vector<std::pair<Edges*, std::vector<std::pair<T, int>>>> groups;
+    auto arc = [&](const T& u, const T& v, int weight) {
+        auto [it, fresh] = group_of.try_emplace(u, groups.size());
+        if (fresh) groups.emplace_back(&adj[u], std::vector<std::pair<T, int>>());
+        groups[it->second].second.emplace_back(v, weight);
+    };
+    for (const WeightedEdge<T>& e : edges) {
+        arc(e.u, e.v, e.weight);
+        if (!directed) arc(e.v, e.u, e.weight);
+        else add_node(e.v);
+    }
+    for (auto& [dest, arcs] : groups) dest->insert_range(arcs.begin(), arcs.end());
+}
+
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::remove_edges(const std::vector<std::pair<T, T>>& edges) {
+    FlatHashMap<T, size_t> group_of(edges.size());
+    std::vector<std::pair<Edges*, std::vector<T>>> groups;
+    auto arc = [&](const T& u, const T& v) {
+        auto it = group_of.find(u);
+        if (it == group_of.end()) {
+            auto list = adj.find(u);
+            if (list == adj.end()) return;
+            it = group_of.try_emplace(u, groups.size()).first;
+            groups.emplace_back(&list->second, std::vector<T>());
         }
+        groups[it->second].second.push_back(v);
+    };
+    for (const auto& [u, v] : edges) {
+        arc(u, v);
+        if (!directed) arc(v, u);
     }
-    return false;
+    for (auto& [dest, targets] : groups) dest->erase_all(targets);
 }
 
-template<typename T>
-std::vector<T> Graph<T>::neighbors(const T& u) const {
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::remove_node(const T& u) {
+    auto it = adj.find(u);
+    if (it == adj.end()) return;
+    if (order) order->erase(u);
+    if (directed) {
+        // No reverse index, so every vertex may point at u
+        for (auto& [_, edges] : adj) edges.erase(u);
+    } else {
+        for (const auto& [v, _] : it->second) {
+            if (!(v == u)) adj.at(v).erase(u);
+        }
+    }
+    adj.erase(u);
+}
+
+template<typename T, typename Adjacency>
+bool Graph<T, Adjacency>::has_edge(const T& u, const T& v) const {
+    auto it = adj.find(u);
+    return it != adj.end() && it->second.contains(v);
+}
+
+template<typename T, typename Adjacency>
+std::vector<T> Graph<T, Adjacency>::neighbors(const T& u) const {
     std::vector<T> result;
     if (adj.count(u)) {
         for (const auto& [v, _] : adj.at(u)) {
@@ -91,8 +296,8 @@ std::vector<T> Graph<T>::neighbors(const T& u) const {
     return result;
 }
 
-template<typename T>
-void Graph<T>::print() const {
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::print() const {
     for (const auto& [u, neighbors] : adj) {
         std::cout << u << " -> ";
         for (const auto& [v, weight] : neighbors) {
@@ -103,26 +308,16 @@ void Graph<T>::print() const {
 }
 
 
-template<typename T>
-bool Graph<T>::dfs(const T& start, const T& target) const {
-    std::unordered_map<T, bool> visited;
-    std::function<bool(const T&)> dfs_helper = [&](const T& node) {
-        if (node == target) return true;
-        visited[node] = true;
-        for (const auto& [neighbor, _] : adj.at(node)) {
-            if (!visited[neighbor]) {
-                if (dfs_helper(neighbor)) return true;
-            }
-        }
-        return false;
-    };
-
+template<typename T, typename Adjacency>
+bool Graph<T, Adjacency>::dfs(const T& start, const T& target) const {
     if (!adj.count(start) || !adj.count(target)) return false;
-    return dfs_helper(start);
+    detail::ReachVisitor<T> vis(target);
+    depth_first(start, vis);
+    return vis.found;
 }
 
-template<typename T>
-bool Graph<T>::bfs(const T& start, const T& target) const {
+template<typename T, typename Adjacency>
+bool Graph<T, Adjacency>::bfs(const T& start, const T& target) const {
     if (!adj.count(start) || !adj.count(target)) return false;
 
     std::unordered_map<T, bool> visited;
@@ -147,157 +342,259 @@ bool Graph<T>::bfs(const T& start, const T& target) const {
 }
 
 
-template<typename T>
-bool Graph<T>::has_cycle() const {
-    std::unordered_map<T, bool> visited;
-    std::function<bool(const T&, const T&)> dfs_cycle;
-
-    if (directed) {
-        std::unordered_map<T, int> state; // 0: unvisited, 1: visiting, 2: visited
-
-        std::function<bool(const T&)> detect = [&](const T& node) {
-            state[node] = 1;
-            for (auto [nbr, _] : adj.at(node)) {
-                if (state[nbr] == 1) return true; // back edge
-                if (state[nbr] == 0 && detect(nbr)) return true;
-            }
-            state[node] = 2;
-            return false;
-        };
-
-        for (const auto& [node, _] : adj) {
-            if (state[node] == 0 && detect(node)) return true;
-        }
-        return false;
-    } else {
-        dfs_cycle = [&](const T& node, const T& parent) {
-            visited[node] = true;
-            for (auto [nbr, _] : adj.at(node)) {
-                if (!visited[nbr]) {
-                    if (dfs_cycle(nbr, node)) return true;
-                } else if (nbr != parent) {
-                    return true; // found cycle
-                }
-            }
-            return false;
-        };
+template<typename T, typename Adjacency>
+bool Graph<T, Adjacency>::has_cycle() const {
+    if (order) return false;  // Cycle-closing edges were refused
+    detail::CycleVisitor<T> vis(directed);
+    depth_first(vis);
+    return vis.found;
+}
 
-        for (const auto& [node, _] : adj) {
-            if (!visited[node] && dfs_cycle(node, node)) return true;
-        }
+template<typename T, typename Adjacency>
+template<typename Visitor>
+void Graph<T, Adjacency>::depth_first(const T& root, Visitor& vis) const {
+    if (!adj.count(root)) throw std::out_of_range("Vertex not in graph");
+    SearchAdaptor search{*this, FlatHashMap<T, detail::Color>(adj.size())};
+    vis.start_vertex(root);
+    if (!vis.done()) detail::dfs_visit(search, root, vis);
+}
 
-        return false;
+template<typename T, typename Adjacency>
+template<typename Visitor>
+void Graph<T, Adjacency>::depth_first(Visitor& vis) const {
+    SearchAdaptor search{*this, FlatHashMap<T, detail::Color>(adj.size())};
+    for (const auto& [root, _] : adj) {
+        if (search.color(root) != detail::Color::white) continue;
+        vis.start_vertex(root);
+        if (vis.done() || !detail::dfs_visit(search, root, vis)) return;
     }
 }
 
-
-template<typename T>
-std::vector<T> Graph<T>::topological_sort() const {
+template<typename T, typename Adjacency>
+TopologicalOrder<T> Graph<T, Adjacency>::topological_order() const {
     if (!directed) {
         throw std::logic_error("Topological sort only applies to directed graphs.");
     }
+    if (order) return {order->order(), {}};
+
+    CSRGraph<T> csr = freeze();
+    auto sorted = csr.topological_order();
+    TopologicalOrder<T> result;
+    result.order.reserve(sorted.order.size());
+    for (uint32_t v : sorted.order) result.order.push_back(csr.vertex(v));
+    for (uint32_t v : sorted.cycle) result.cycle.push_back(csr.vertex(v));
+    return result;
+}
 
-    std::unordered_map<T, bool> visited;
-    std::vector<T> result;
-    bool hasCycle = false;
-
-    std::function<void(const T&)> dfs = [&](const T& node) {
-        visited[node] = true;
-        for (const auto& [nbr, _] : adj.at(node)) {
-            if (!visited[nbr]) {
-                dfs(nbr);
-            }
-        }
-        result.push_back(node); // postorder
-    };
+template<typename T, typename Adjacency>
+std::vector<T> Graph<T, Adjacency>::topological_sort() const {
+    TopologicalOrder<T> sorted = topological_order();
+    if (!sorted.cycle.empty()) throw std::logic_error("Topological sort needs an acyclic graph.");
+    return std::move(sorted.order);
+}
 
-    for (const auto& [node, _] : adj) {
-        if (!visited[node]) {
-            dfs(node);
-        }
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::track_topological_order(bool on) {
+    if (!on) {
+        order.reset();
+        return;
     }
+    if (order) return;
+    TopologicalOrder<T> sorted = topological_order();
+    if (!sorted.cycle.empty()) {
+        throw std::logic_error("Graph has a cycle; no topological order exists.");
+    }
+    detail::IncrementalOrder<T> tracked;
+    for (const T& v : sorted.order) tracked.push_back(v);
+    order = std::move(tracked);
+}
 
-    std::reverse(result.begin(), result.end());
+template<typename T, typename Adjacency>
+BFSTree<T> Graph<T, Adjacency>::bfs_tree(const T& start, size_t threads) const {
+    if (!adj.count(start)) throw std::out_of_range("Vertex not in graph");
+    CSRGraph<T> csr = freeze();
+    auto tree = csr.bfs_tree(csr.id_of(start), threads);
+
+    BFSTree<T> result;
+    for (uint32_t v = 0; v < csr.vertex_count(); ++v) {
+        if (tree.distance[v] == CSRGraph<T>::npos) continue;
+        result.distance[csr.vertex(v)] = tree.distance[v];
+        if (tree.parent[v] != CSRGraph<T>::npos) result.parent[csr.vertex(v)] = csr.vertex(tree.parent[v]);
+    }
     return result;
 }
 
-template<typename T>
-void Graph<T>::export_dot(const std::string& filename) const {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Unable to open file: " + filename);
+template<typename T, typename Adjacency>
+SpanningTree<T> Graph<T, Adjacency>::to_vertices(const CSRGraph<T>& csr, const SpanningTree<uint32_t>& tree) {
+    SpanningTree<T> result;
+    result.total_weight = tree.total_weight;
+    result.edges.reserve(tree.edges.size());
+    for (const auto& e : tree.edges) {
+        result.edges.push_back({csr.vertex(e.u), csr.vertex(e.v), e.weight});
     }
+    return result;
+}
 
-    std::string graph_type = directed ? "digraph" : "graph";
-    std::string connector = directed ? " -> " : " -- ";
+template<typename T, typename Adjacency>
+SpanningTree<T> Graph<T, Adjacency>::kruskal_mst(size_t threads) const {
+    if (directed) throw std::logic_error("Minimum spanning tree only applies to undirected graphs.");
+    CSRGraph<T> csr = freeze();
+    return to_vertices(csr, csr.kruskal_mst(threads));
+}
 
-    file << graph_type << " G {\n";
+template<typename T, typename Adjacency>
+SpanningTree<T> Graph<T, Adjacency>::prim_mst() const {
+    if (directed) throw std::logic_error("Minimum spanning tree only applies to undirected graphs.");
+    CSRGraph<T> csr = freeze();
+    return to_vertices(csr, csr.prim_mst());
+}
 
-    std::unordered_map<T, std::unordered_map<T, bool>> written;
+template<typename T, typename Adjacency>
+SpanningTree<T> Graph<T, Adjacency>::boruvka_mst(size_t threads) const {
+    if (directed) throw std::logic_error("Minimum spanning tree only applies to undirected graphs.");
+    CSRGraph<T> csr = freeze();
+    return to_vertices(csr, csr.boruvka_mst(threads));
+}
 
-    for (const auto& [u, neighbors] : adj) {
-        if (neighbors.empty()) {
-            file << "    \"" << u << "\";\n";
-        }
+template<typename T, typename Adjacency>
+ShortestPaths<T> Graph<T, Adjacency>::dijkstra(const T& source) const {
+    return dijkstra_impl(source, nullptr);
+}
 
-        for (const auto& [v, weight] : neighbors) {
-            if (!directed && written[v][u]) continue;
-            file << "    \"" << u << "\"" << connector << "\"" << v << "\"";
-            if (weight != 1)
-                file << " [label=" << weight << "]";
-            file << ";\n";
-            written[u][v] = true;
+template<typename T, typename Adjacency>
+ShortestPaths<T> Graph<T, Adjacency>::dijkstra(const T& source, const T& target) const {
+    return dijkstra_impl(source, &target);
+}
+
+template<typename T, typename Adjacency>
+ShortestPaths<T> Graph<T, Adjacency>::dijkstra_impl(const T& source, const T* target) const {
+    if (!adj.count(source)) throw std::out_of_range("Vertex not in graph");
+
+    // Order by distance only, so T needs no operator<
+    using Item = std::pair<long long, T>;
+    struct ByDistance {
+        bool operator()(const Item& a, const Item& b) const { return a.first < b.first; }
+    };
+
+    ShortestPaths<T> result;
+    Heap<Item, ByDistance, 4> heap;
+    result.distance[source] = 0;
+    heap.emplace(0, source);
+
+    while (!heap.empty()) {
+        auto [d, u] = heap.pop_value();
+        if (d != result.distance.at(u)) continue;  // Superseded by a shorter entry
+        if (target && u == *target) break;
+
+        for (const auto& [v, weight] : adj.at(u)) {
+            if (weight < 0) throw std::invalid_argument("Dijkstra needs non-negative edge weights");
+            long long nd = d + weight;
+            auto it = result.distance.find(v);
+            if (it == result.distance.end() || nd < it->second) {
+                result.distance[v] = nd;
+                result.predecessor[v] = u;
+                heap.emplace(nd, v);
+            }
         }
     }
-
-    file << "}\n";
-    file.close();
+    return result;
 }
 
-template<typename T>
-void Graph<T>::export_png(const std::string& png_filename) const {
-    const std::string dot_filename = "__temp_graph.dot";
+template<typename T, typename Adjacency>
+CSRGraph<T> Graph<T, Adjacency>::freeze() const {
+    using vertex_id = typename CSRGraph<T>::vertex_id;
 
-    // Step 1: Write DOT file
-    std::ofstream file(dot_filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Unable to open temp DOT file.");
+    std::vector<T> names;
+    names.reserve(adj.size());
+    FlatHashMap<T, vertex_id> ids(adj.size());
+    for (const auto& [u, _] : adj) {
+        ids.try_emplace(u, static_cast<vertex_id>(names.size()));
+        names.push_back(u);
     }
 
-    std::string graph_type = directed ? "digraph" : "graph";
-    std::string connector = directed ? " -> " : " -- ";
+    // adj is not modified in between, so both passes see the same order as names
+    std::vector<uint64_t> offsets(names.size() + 1, 0);
+    size_t i = 0;
+    for (const auto& [_, neighbors] : adj) {
+        offsets[i + 1] = offsets[i] + neighbors.size();
+        ++i;
+    }
 
-    file << graph_type << " G {\n";
+    std::vector<vertex_id> targets;
+    std::vector<int> weights;
+    targets.reserve(offsets.back());
+    weights.reserve(offsets.back());
+    for (const auto& [_, neighbors] : adj) {
+        for (const auto& [v, weight] : neighbors) {
+            targets.push_back(ids.at(v));
+            weights.push_back(weight);
+        }
+    }
+
+    return CSRGraph<T>(std::move(names), std::move(offsets), std::move(targets), std::move(weights), directed);
+}
 
-    std::unordered_map<T, std::unordered_map<T, bool>> written;
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::write_dot(std::ostream& out) const {
+    const char* connector = directed ? " -> " : " -- ";
+    out << (directed ? "digraph" : "graph") << " G {\n";
+
+    // An undirected edge sits in both endpoint lists; write it from the one
+    // iterated first. This needs a per-vertex rank, not a set of written edges.
+    FlatHashMap<T, size_t> rank(directed ? 0 : adj.size());
+    if (!directed) {
+        for (const auto& [u, _] : adj) rank.try_emplace(u, rank.size());
+    }
 
     for (const auto& [u, neighbors] : adj) {
         if (neighbors.empty()) {
-            file << "    \"" << u << "\";\n";
+            out << "    \"" << u << "\";\n";
         }
 
+        size_t u_rank = directed ? 0 : rank.at(u);
+        bool loop_copy = false;  // ListAdjacency keeps an undirected self-loop as two adjacent entries
         for (const auto& [v, weight] : neighbors) {
-            if (!directed && written[v][u]) continue;
-            file << "    \"" << u << "\"" << connector << "\"" << v << "\"";
+            if (!directed) {
+                if (u == v) {
+                    loop_copy = !loop_copy;
+                    if (!loop_copy) continue;
+                } else if (rank.at(v) < u_rank) {
+                    continue;
+                }
+            }
+            out << "    \"" << u << "\"" << connector << "\"" << v << "\"";
             if (weight != 1)
-                file << " [label=" << weight << "]";
-            file << ";\n";
-            written[u][v] = true;
+                out << " [label=" << weight << "]";
+            out << ";\n";
         }
     }
 
-    file << "}\n";
+    out << "}\n";
+}
+
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::export_dot(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file: " + filename);
+    }
+    write_dot(file);
     file.close();
+    if (!file) throw std::runtime_error("Write failed: " + filename);
+}
+
+template<typename T, typename Adjacency>
+void Graph<T, Adjacency>::export_png(const std::string& png_filename) const {
+    const std::string dot_filename = "__temp_graph.dot";
+
+    export_dot(dot_filename);
 
-    // Step 2: Run Graphviz
     std::string command = "dot -Tpng " + dot_filename + " -o " + png_filename;
     int result = std::system(command.c_str());
+    std::remove(dot_filename.c_str());
     if (result != 0) {
         throw std::runtime_error("Graphviz 'dot' command failed.");
     }
-
-    // Step 3: Delete temp DOT file
-    std::remove(dot_filename.c_str());
 }
 
 
@@ -0,0 +1,215 @@
+#pragma once
+#ifndef MAYDSA_GRAPH_ADJACENCY_HPP
+#define MAYDSA_GRAPH_ADJACENCY_HPP
+
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "flat_hash_map.hpp"
+
+namespace MayDSA {
+
+/*
+ * Adjacency policies for Graph<T, Adjacency>. Each provides edges<T>, the
+ * per-vertex container of (neighbor, weight) pairs, with one interface:
+ * insert/insert_range, erase/erase_all, contains, size/empty and const
+ * iteration over entries with .first (neighbor) and .second (weight). The
+ * policy fixes the cost of each query and whether parallel edges exist.
+ */
+
+/**
+ * @brief Insertion-ordered std::list per vertex (the original layout).
+ *
+ * Parallel edges are kept side by side: insert is O(1), contains and erase
+ * scan the list.
+ */
+struct ListAdjacency {
+    template<typename T>
+    class edges {
+    private:
+        std::list<std::pair<T, int>> items;
+
+    public:
+        using const_iterator = typename std::list<std::pair<T, int>>::const_iterator;
+
+        // Always adds an arc, so always reports it as new
+        bool insert(const T& v, int weight) {
+            items.emplace_back(v, weight);
+            return true;
+        }
+
+        template<typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            items.insert(items.end(), first, last);
+        }
+
+        // Remove every arc to v; returns how many went
+        size_t erase(const T& v) {
+            size_t before = items.size();
+            items.remove_if([&](const std::pair<T, int>& p) { return p.first == v; });
+            return before - items.size();
+        }
+
+        // Remove every arc to any of targets in a single pass
+        size_t erase_all(const std::vector<T>& targets) {
+            FlatHashMap<T, bool> doomed(targets.size());
+            for (const T& v : targets) doomed.try_emplace(v, true);
+            size_t before = items.size();
+            items.remove_if([&](const std::pair<T, int>& p) { return doomed.contains(p.first); });
+            return before - items.size();
+        }
+
+        bool contains(const T& v) const {
+            return std::any_of(items.begin(), items.end(), [&](const std::pair<T, int>& p) { return p.first == v; });
+        }
+
+        size_t size() const { return items.size(); }
+        bool empty() const { return items.empty(); }
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end() const { return items.end(); }
+    };
+};
+
+/**
+ * @brief Flat vector per vertex, kept sorted by neighbor (T needs operator<).
+ *
+ * At most one arc per neighbor; inserting an existing one updates its
+ * weight. contains is a binary search, insert and erase shift the tail, and
+ * insert_range merges a whole batch in O(deg + k log k). Neighbors are
+ * iterated in ascending order.
+ */
+struct SortedAdjacency {
+    template<typename T>
+    class edges {
+    private:
+        using Entry = std::pair<T, int>;
+        std::vector<Entry> items;
+
+        static bool by_neighbor(const Entry& a, const Entry& b) { return a.first < b.first; }
+
+        typename std::vector<Entry>::iterator lower(const T& v) {
+            return std::lower_bound(items.begin(), items.end(), v, [](const Entry& e, const T& key) { return e.first < key; });
+        }
+
+        typename std::vector<Entry>::const_iterator lower(const T& v) const {
+            return std::lower_bound(items.begin(), items.end(), v, [](const Entry& e, const T& key) { return e.first < key; });
+        }
+
+    public:
+        using const_iterator = typename std::vector<Entry>::const_iterator;
+
+        // True if v was not a neighbor yet
+        bool insert(const T& v, int weight) {
+            auto it = lower(v);
+            if (it != items.end() && !(v < it->first)) {
+                it->second = weight;
+                return false;
+            }
+            items.insert(it, Entry(v, weight));
+            return true;
+        }
+
+        template<typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            size_t old_size = items.size();
+            items.insert(items.end(), first, last);
+            auto mid = items.begin() + old_size;
+            std::stable_sort(mid, items.end(), by_neighbor);
+            std::inplace_merge(items.begin(), mid, items.end(), by_neighbor);
+            // Both steps are stable, so the last entry of each equal run is the
+            // latest insert; keep it, as a sequence of insert() calls would
+            auto out = items.begin();
+            for (auto it = items.begin(); it != items.end();) {
+                auto next = it + 1;
+                while (next != items.end() && !(it->first < next->first)) ++next;
+                if (out != next - 1) *out = std::move(*(next - 1));
+                ++out;
+                it = next;
+            }
+            items.erase(out, items.end());
+        }
+
+        size_t erase(const T& v) {
+            auto it = lower(v);
+            if (it == items.end() || v < it->first) return 0;
+            items.erase(it);
+            return 1;
+        }
+
+        size_t erase_all(const std::vector<T>& targets) {
+            std::vector<T> doomed(targets);
+            std::sort(doomed.begin(), doomed.end());
+            size_t before = items.size();
+            items.erase(std::remove_if(items.begin(), items.end(),
+                                       [&](const Entry& e) { return std::binary_search(doomed.begin(), doomed.end(), e.first); }),
+                        items.end());
+            return before - items.size();
+        }
+
+        bool contains(const T& v) const {
+            auto it = lower(v);
+            return it != items.end() && !(v < it->first);
+        }
+
+        size_t size() const { return items.size(); }
+        bool empty() const { return items.empty(); }
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end() const { return items.end(); }
+    };
+};
+
+/**
+ * @brief FlatHashMap from neighbor to weight per vertex.
+ *
+ * At most one arc per neighbor; inserting an existing one updates its
+ * weight. contains, insert and erase are expected O(1) however large the
+ * degree, which suits hub-heavy graphs. Iteration order is unspecified.
+ */
+struct HashAdjacency {
+    template<typename T>
+    class edges {
+    private:
+        FlatHashMap<T, int> items;
+
+    public:
+        using const_iterator = typename FlatHashMap<T, int>::const_iterator;
+
+        bool insert(const T& v, int weight) {
+            auto [it, fresh] = items.try_emplace(v, weight);
+            if (!fresh) it->second = weight;
+            return fresh;
+        }
+
+        template<typename InputIt>
+        void insert_range(InputIt first, InputIt last) {
+            using Category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value)
+                items.reserve(items.size() + static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first) insert(first->first, first->second);
+        }
+
+        size_t erase(const T& v) {
+            return items.erase(v);
+        }
+
+        size_t erase_all(const std::vector<T>& targets) {
+            size_t removed = 0;
+            for (const T& v : targets) removed += items.erase(v);
+            return removed;
+        }
+
+        bool contains(const T& v) const { return items.contains(v); }
+
+        size_t size() const { return items.size(); }
+        bool empty() const { return items.empty(); }
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end() const { return items.end(); }
+    };
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_GRAPH_ADJACENCY_HPP
@@ -0,0 +1,590 @@
+#pragma once
+#ifndef MAYDSA_GRAPH_IO_HPP
+#define MAYDSA_GRAPH_IO_HPP
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <stdexcept>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <bitset>
+#include <charconv>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vector.hpp"
+#include "csr_graph.hpp"
+#include "parallel.hpp"
+
+/**
+ * @brief Bulk graph I/O for CSRGraph (POSIX only).
+ *
+ * load_edge_list() mmaps a SNAP-style text edge list and parses it in
+ * parallel straight into CSR arrays. save_binary() writes a CSRGraph as a
+ * flat binary file that MappedCSRGraph maps read-only and queries in place,
+ * so reopening a graph costs one mmap instead of a parse.
+ */
+namespace MayDSA {
+
+namespace detail {
+
+// Read-only mapping of a whole file; an empty file maps to nothing
+class FileMapping {
+private:
+    int fd;
+    const char* base;
+    size_t length;
+
+    void close() {
+        if (base) ::munmap(const_cast<char*>(base), length);
+        if (fd >= 0) ::close(fd);
+        base = nullptr;
+        fd = -1;
+        length = 0;
+    }
+
+    [[noreturn]] void fail(const std::string& context, const std::string& what) {
+        int err = errno;
+        close();
+        throw std::runtime_error(context + ": " + what + ": " + std::strerror(err));
+    }
+
+public:
+    // context prefixes error messages, e.g. "load_edge_list(graph.txt)"
+    FileMapping(const std::string& filename, const std::string& context) : fd(-1), base(nullptr), length(0) {
+        fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) fail(context, "open failed");
+        struct stat st;
+        if (::fstat(fd, &st) != 0) fail(context, "fstat failed");
+        length = static_cast<size_t>(st.st_size);
+        if (length == 0) return;
+        void* p = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) fail(context, "mmap failed");
+        base = static_cast<const char*>(p);
+    }
+
+    ~FileMapping() {
+        close();
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    FileMapping(FileMapping&& other) noexcept : fd(other.fd), base(other.base), length(other.length) {
+        other.fd = -1;
+        other.base = nullptr;
+        other.length = 0;
+    }
+
+    FileMapping& operator=(FileMapping&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(fd, other.fd);
+            std::swap(base, other.base);
+            std::swap(length, other.length);
+        }
+        return *this;
+    }
+
+    // Hint that the pages will be read front to back
+    void advise_sequential() const {
+#ifdef MADV_SEQUENTIAL
+        if (base) ::madvise(const_cast<char*>(base), length, MADV_SEQUENTIAL);
+#endif
+    }
+
+    const char* data() const { return base; }
+    size_t size() const { return length; }
+};
+
+template<typename T>
+struct RawEdge {
+    T u;
+    T v;
+    int weight;
+};
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == '\r';
+}
+
+// Parse the next integer field of a line; false if the line has no more fields
+template<typename I>
+bool parse_field(const char*& p, const char* eol, I& out) {
+    while (p < eol && is_blank(*p)) ++p;
+    if (p == eol) return false;
+    auto [next, ec] = std::from_chars(p, eol, out);
+    if (ec != std::errc() || (next < eol && !is_blank(*next))) return false;
+    p = next;
+    return true;
+}
+
+// Parse every line that starts in [p, stop); the last one may run on to file_end.
+// Lines are "u v [weight]"; blank lines and lines starting with # or % are skipped.
+template<typename T>
+void parse_edge_lines(const char* file_begin, const char* p, const char* stop, const char* file_end,
+                      std::vector<RawEdge<T>>& out) {
+    while (p < stop) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', file_end - p));
+        if (!eol) eol = file_end;
+        const char* q = p;
+        while (q < eol && is_blank(*q)) ++q;
+        if (q < eol && *q != '#' && *q != '%') {
+            RawEdge<T> e{T(), T(), 1};
+            bool ok = parse_field(q, eol, e.u) && parse_field(q, eol, e.v);
+            if (ok) {
+                const char* rest = q;
+                while (rest < eol && is_blank(*rest)) ++rest;
+                ok = rest == eol || parse_field(q, eol, e.weight);
+            }
+            if (!ok) throw std::runtime_error("malformed edge at byte " + std::to_string(p - file_begin));
+            out.push_back(e);
+        }
+        p = eol + 1;
+    }
+}
+
+inline size_t popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(x));
+#else
+    return std::bitset<64>(x).count();
+#endif
+}
+
+/**
+ * Maps integer labels to dense ids in ascending label order. Labels spanning
+ * a range not much larger than the edge count (the usual SNAP case) are
+ * ranked with a bitmap and a per-word prefix count, O(1) per lookup;
+ * scattered labels fall back to a sorted array and binary search.
+ */
+template<typename T>
+class LabelRanker {
+private:
+    using Bits = std::make_unsigned_t<T>;
+
+    bool bitmap_mode = false;
+    Bits low = 0;
+    AtomicBitset present;
+    std::vector<uint64_t> rank;  // Set bits before each word
+
+public:
+    std::vector<T> names;  // id -> label
+
+    LabelRanker(const std::vector<std::vector<RawEdge<T>>>& parts, size_t threads) {
+        std::vector<std::pair<T, T>> bounds(threads);
+        run_threads(threads, [&](size_t t) {
+            if (parts[t].empty()) return;
+            T lo = parts[t][0].u, hi = lo;
+            for (const RawEdge<T>& e : parts[t]) {
+                lo = std::min({lo, e.u, e.v});
+                hi = std::max({hi, e.u, e.v});
+            }
+            bounds[t] = {lo, hi};
+        });
+        size_t edges = 0;
+        bool any = false;
+        T lo = T(), hi = T();
+        for (size_t t = 0; t < threads; ++t) {
+            if (parts[t].empty()) continue;
+            edges += parts[t].size();
+            lo = any ? std::min(lo, bounds[t].first) : bounds[t].first;
+            hi = any ? std::max(hi, bounds[t].second) : bounds[t].second;
+            any = true;
+        }
+        if (!any) return;
+
+        Bits span = static_cast<Bits>(static_cast<Bits>(hi) - static_cast<Bits>(lo));
+        // At most ~2 bytes of bitmap per edge; the + 1 below must not wrap either
+        bitmap_mode = span < std::numeric_limits<Bits>::max() && span / 16 <= edges + 4096;
+        if (bitmap_mode) {
+            low = static_cast<Bits>(lo);
+            present = AtomicBitset(static_cast<size_t>(span) + 1);
+            run_threads(threads, [&](size_t t) {
+                for (const RawEdge<T>& e : parts[t]) {
+                    present.test_and_set(static_cast<Bits>(e.u) - low);
+                    present.test_and_set(static_cast<Bits>(e.v) - low);
+                }
+            });
+            size_t words = present.word_count();
+            rank.resize(words + 1);
+            rank[0] = 0;
+            for (size_t w = 0; w < words; ++w) rank[w + 1] = rank[w] + popcount64(present.word(w));
+            names.resize(rank[words]);
+            run_threads(threads, [&](size_t t) {
+                for (size_t w = words * t / threads; w < words * (t + 1) / threads; ++w) {
+                    uint64_t bits = present.word(w);
+                    for (size_t k = rank[w]; bits; bits &= bits - 1, ++k) {
+                        size_t bit = static_cast<size_t>(popcount64((bits & (0 - bits)) - 1));
+                        names[k] = static_cast<T>(static_cast<Bits>(low + w * 64 + bit));
+                    }
+                }
+            });
+            return;
+        }
+
+        std::vector<std::vector<T>> local(threads);
+        run_threads(threads, [&](size_t t) {
+            std::vector<T>& seen = local[t];
+            seen.reserve(2 * parts[t].size());
+            for (const RawEdge<T>& e : parts[t]) {
+                seen.push_back(e.u);
+                seen.push_back(e.v);
+            }
+            std::sort(seen.begin(), seen.end());
+            seen.erase(std::unique(seen.begin(), seen.end()), seen.end());
+        });
+        for (auto& seen : local) {
+            names.insert(names.end(), seen.begin(), seen.end());
+            std::vector<T>().swap(seen);
+        }
+        parallel_sort(names.begin(), names.end(), std::less<T>(), threads);
+        names.erase(std::unique(names.begin(), names.end()), names.end());
+    }
+
+    uint32_t operator()(T label) const {
+        if (bitmap_mode) {
+            size_t d = static_cast<size_t>(static_cast<Bits>(label) - low);
+            uint64_t below = present.word(d >> 6) & ((uint64_t(1) << (d & 63)) - 1);
+            return static_cast<uint32_t>(rank[d >> 6] + popcount64(below));
+        }
+        return static_cast<uint32_t>(std::lower_bound(names.begin(), names.end(), label) - names.begin());
+    }
+};
+
+// Fixed 64-byte header of the binary CSR format
+struct CSRFileHeader {
+    char magic[8];          // "MAYDSACG"
+    uint32_t version;
+    uint32_t flags;         // Bit 0: directed
+    uint64_t name_size;     // sizeof(T) of the vertex labels
+    uint64_t vertex_count;
+    uint64_t arc_count;
+    uint64_t reserved[3];
+};
+static_assert(sizeof(CSRFileHeader) == 64, "CSR file header must stay 64 bytes");
+
+constexpr uint32_t csr_file_version = 1;
+constexpr uint32_t csr_file_directed = 1;
+
+// Byte offset of every section; each starts on a cache-line boundary
+struct CSRFileLayout {
+    uint64_t names, dictionary, offsets, targets, weights, end;
+
+    static uint64_t align(uint64_t x) {
+        return (x + cache_line - 1) / cache_line * cache_line;
+    }
+
+    CSRFileLayout(uint64_t name_size, uint64_t n, uint64_t m) {
+        names = sizeof(CSRFileHeader);
+        dictionary = align(names + n * name_size);
+        offsets = align(dictionary + n * sizeof(uint32_t));
+        targets = align(offsets + (n + 1) * sizeof(uint64_t));
+        weights = align(targets + m * sizeof(uint32_t));
+        end = weights + m * sizeof(int32_t);
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Parse a whitespace-separated edge list ("u v [weight]" per line) into a CSRGraph.
+ *
+ * The file is mmapped and split into one byte range per thread, cut at line
+ * boundaries; each thread parses its range, then labels are ranked to dense
+ * ids (ascending label order) and arcs are counted, grouped by row block
+ * and scattered into the CSR arrays, all in parallel. Lines starting with #
+ * or % are comments; a missing weight is 1. Undirected graphs store each edge
+ * as two arcs, as Graph does. Rows keep file order whatever the thread count.
+ *
+ * @tparam T Integer vertex label type.
+ * @param threads Worker threads to use (0 = hardware concurrency).
+ */
+template<typename T = uint64_t>
+CSRGraph<T> load_edge_list(const std::string& filename, bool isDirected, size_t threads = 0) {
+    static_assert(std::is_integral<T>::value, "load_edge_list needs integer vertex labels");
+    using vertex_id = typename CSRGraph<T>::vertex_id;
+
+    const std::string context = "load_edge_list(" + filename + ")";
+    detail::FileMapping file(filename, context);
+    file.advise_sequential();
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    // Keep ranges at least 1 MiB so small files do not pay for idle threads
+    threads = std::max<size_t>(1, std::min<size_t>(threads, file.size() >> 20));
+
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    std::vector<std::vector<detail::RawEdge<T>>> parts(threads);
+    detail::run_threads_rethrow(threads, [&](size_t t) {
+        const char* lo = begin + file.size() * t / threads;
+        const char* hi = begin + file.size() * (t + 1) / threads;
+        // A line belongs to the range it starts in
+        if (t > 0 && lo[-1] != '\n') {
+            const char* nl = static_cast<const char*>(std::memchr(lo, '\n', end - lo));
+            lo = nl ? nl + 1 : end;
+        }
+        parts[t].reserve((hi - lo) / 12);
+        try {
+            detail::parse_edge_lines(begin, lo, hi, end, parts[t]);
+        } catch (const std::runtime_error& e) {
+            throw std::runtime_error(context + ": " + e.what());
+        }
+    });
+
+    detail::LabelRanker<T> ranker(parts, threads);
+    size_t n = ranker.names.size();
+    if (n >= CSRGraph<T>::npos) throw std::length_error("Too many vertices for 32-bit ids");
+
+    // Arcs are grouped by blocks of 2^14 consecutive source rows before the
+    // final scatter, so each block's writes hit a cache-sized set of rows.
+    // Staging is block-major, thread-minor, so rows keep file order.
+    const size_t block_shift = 14;
+    const size_t blocks = (n >> block_shift) + 1;
+    std::vector<std::atomic<uint64_t>> degree(n);
+    for (auto& d : degree) d.store(0, std::memory_order_relaxed);
+    std::vector<uint64_t> slots(threads * blocks, 0);  // Arcs per (thread, block), then staging cursors
+    detail::run_threads(threads, [&](size_t t) {
+        uint64_t* mine = &slots[t * blocks];
+        for (const detail::RawEdge<T>& e : parts[t]) {
+            vertex_id u = ranker(e.u);
+            degree[u].fetch_add(1, std::memory_order_relaxed);
+            ++mine[u >> block_shift];
+            if (!isDirected) {
+                vertex_id v = ranker(e.v);
+                degree[v].fetch_add(1, std::memory_order_relaxed);
+                ++mine[v >> block_shift];
+            }
+        }
+    });
+
+    std::vector<uint64_t> offsets(n + 1, 0);
+    for (size_t v = 0; v < n; ++v) offsets[v + 1] = offsets[v] + degree[v].load(std::memory_order_relaxed);
+    std::vector<std::atomic<uint64_t>>().swap(degree);
+    std::vector<uint64_t> block_start(blocks + 1, 0);
+    for (size_t b = 0; b < blocks; ++b) {
+        uint64_t at = block_start[b];
+        for (size_t t = 0; t < threads; ++t) {
+            uint64_t count = slots[t * blocks + b];
+            slots[t * blocks + b] = at;
+            at += count;
+        }
+        block_start[b + 1] = at;
+    }
+
+    std::vector<detail::RawEdge<vertex_id>> staged(offsets.back());  // (source, target, weight)
+    detail::run_threads(threads, [&](size_t t) {
+        uint64_t* cursor = &slots[t * blocks];
+        for (const detail::RawEdge<T>& e : parts[t]) {
+            vertex_id u = ranker(e.u), v = ranker(e.v);
+            staged[cursor[u >> block_shift]++] = {u, v, e.weight};
+            if (!isDirected) staged[cursor[v >> block_shift]++] = {v, u, e.weight};
+        }
+        std::vector<detail::RawEdge<T>>().swap(parts[t]);
+    });
+
+    // Each block owns its rows, so blocks scatter independently with plain cursors
+    std::vector<vertex_id> targets(offsets.back());
+    std::vector<int> weights(offsets.back());
+    std::vector<uint64_t> row_cursor(offsets.begin(), offsets.end() - 1);
+    std::atomic<size_t> next_block{0};
+    detail::run_threads(threads, [&](size_t) {
+        for (size_t b; (b = next_block.fetch_add(1, std::memory_order_relaxed)) < blocks;) {
+            for (uint64_t i = block_start[b]; i < block_start[b + 1]; ++i) {
+                const detail::RawEdge<vertex_id>& a = staged[i];
+                uint64_t slot = row_cursor[a.u]++;
+                targets[slot] = a.v;
+                weights[slot] = a.weight;
+            }
+        }
+    });
+
+    return CSRGraph<T>(std::move(ranker.names), std::move(offsets), std::move(targets), std::move(weights),
+                       isDirected);
+}
+
+/**
+ * @brief Write g in the binary CSR format read by MappedCSRGraph.
+ *
+ * Layout: a 64-byte header, then the label array, a dictionary of ids sorted
+ * by label (for binary-search lookup), the row offsets, targets and weights,
+ * each section 64-byte aligned. Integers are stored in native byte order.
+ *
+ * @tparam T Trivially copyable label type with operator<.
+ */
+template<typename T>
+void save_binary(const CSRGraph<T>& g, const std::string& filename) {
+    static_assert(std::is_trivially_copyable<T>::value, "save_binary needs trivially copyable vertex labels");
+    using vertex_id = typename CSRGraph<T>::vertex_id;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file: " + filename);
+    }
+
+    size_t n = g.vertex_count(), m = g.edge_count();
+    detail::CSRFileHeader header{};
+    std::memcpy(header.magic, "MAYDSACG", 8);
+    header.version = detail::csr_file_version;
+    header.flags = g.is_directed() ? detail::csr_file_directed : 0;
+    header.name_size = sizeof(T);
+    header.vertex_count = n;
+    header.arc_count = m;
+    detail::CSRFileLayout layout(sizeof(T), n, m);
+
+    uint64_t written = 0;
+    auto put = [&](uint64_t at, const void* bytes, size_t count) {
+        static const char zeros[detail::cache_line] = {};
+        file.write(zeros, static_cast<std::streamsize>(at - written));
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+        written = at + count;
+    };
+
+    std::vector<T> names(n);
+    for (size_t i = 0; i < n; ++i) names[i] = g.vertex(static_cast<vertex_id>(i));
+    std::vector<vertex_id> dictionary(n);
+    std::iota(dictionary.begin(), dictionary.end(), vertex_id(0));
+    std::sort(dictionary.begin(), dictionary.end(), [&](vertex_id a, vertex_id b) { return names[a] < names[b]; });
+
+    put(0, &header, sizeof(header));
+    put(layout.names, names.data(), n * sizeof(T));
+    put(layout.dictionary, dictionary.data(), n * sizeof(vertex_id));
+    put(layout.offsets, g.row_offsets().data(), (n + 1) * sizeof(uint64_t));
+    put(layout.targets, g.column_targets().data(), m * sizeof(vertex_id));
+    put(layout.weights, g.edge_weights().data(), m * sizeof(int));
+    file.close();
+    if (!file) throw std::runtime_error("Write failed: " + filename);
+}
+
+/**
+ * @brief Read-only CSR graph served directly from a save_binary() file.
+ *
+ * Opening validates the header and section sizes and maps the file; every
+ * query then reads the mapped arrays, so nothing is parsed or copied and the
+ * page cache is shared between processes. Label lookup is a binary search
+ * over the stored dictionary. The arrays themselves are trusted, not checked.
+ * to_csr() copies the graph into a CSRGraph for the full algorithm set.
+ */
+template<typename T>
+class MappedCSRGraph {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedCSRGraph needs trivially copyable vertex labels");
+
+public:
+    using vertex_id = typename CSRGraph<T>::vertex_id;
+    static constexpr vertex_id npos = CSRGraph<T>::npos;
+
+private:
+    detail::FileMapping file;
+    const detail::CSRFileHeader* header;
+    const T* names;
+    const vertex_id* dictionary;  // Ids in ascending label order
+    const uint64_t* offsets;
+    const vertex_id* targets;
+    const int* weights;
+
+    template<typename U>
+    const U* section(uint64_t at) const {
+        return reinterpret_cast<const U*>(file.data() + at);
+    }
+
+    const vertex_id* find(const T& u) const;
+
+public:
+    explicit MappedCSRGraph(const std::string& filename);
+
+    size_t vertex_count() const { return header->vertex_count; }
+    size_t edge_count() const { return header->arc_count; }  // Stored arcs
+    bool is_directed() const { return header->flags & detail::csr_file_directed; }
+
+    bool contains(const T& u) const { return find(u) != nullptr; }
+    vertex_id id_of(const T& u) const;
+    const T& vertex(vertex_id id) const;
+
+    size_t degree(vertex_id v) const { return offsets[v + 1] - offsets[v]; }
+    Span<const vertex_id> neighbors(vertex_id v) const { return Span<const vertex_id>(targets + offsets[v], degree(v)); }
+    Span<const int> weights_of(vertex_id v) const { return Span<const int>(weights + offsets[v], degree(v)); }
+
+    Span<const uint64_t> row_offsets() const { return Span<const uint64_t>(offsets, vertex_count() + 1); }
+    Span<const vertex_id> column_targets() const { return Span<const vertex_id>(targets, edge_count()); }
+    Span<const int> edge_weights() const { return Span<const int>(weights, edge_count()); }
+
+    bool has_edge(const T& u, const T& v) const;
+
+    CSRGraph<T> to_csr() const;
+};
+
+template<typename T>
+MappedCSRGraph<T>::MappedCSRGraph(const std::string& filename)
+    : file(filename, "MappedCSRGraph(" + filename + ")") {
+    auto bad = [&](const std::string& why) {
+        return std::runtime_error("MappedCSRGraph(" + filename + "): " + why);
+    };
+    if (file.size() < sizeof(detail::CSRFileHeader)) throw bad("file too small to be a CSR graph");
+    header = section<detail::CSRFileHeader>(0);
+    if (std::memcmp(header->magic, "MAYDSACG", 8) != 0) throw bad("not a CSR graph file");
+    if (header->version != detail::csr_file_version) throw bad("unsupported format version");
+    if (header->name_size != sizeof(T)) throw bad("vertex label size does not match");
+    // Bound the counts before computing the layout so it cannot overflow
+    if (header->vertex_count >= npos || header->arc_count > file.size()) throw bad("corrupt header");
+    detail::CSRFileLayout layout(sizeof(T), header->vertex_count, header->arc_count);
+    if (layout.end > file.size()) throw bad("file is truncated");
+
+    names = section<T>(layout.names);
+    dictionary = section<vertex_id>(layout.dictionary);
+    offsets = section<uint64_t>(layout.offsets);
+    targets = section<vertex_id>(layout.targets);
+    weights = section<int>(layout.weights);
+    if (offsets[vertex_count()] != edge_count()) throw bad("row offsets do not match the arc count");
+}
+
+template<typename T>
+const typename MappedCSRGraph<T>::vertex_id* MappedCSRGraph<T>::find(const T& u) const {
+    const vertex_id* last = dictionary + vertex_count();
+    const vertex_id* it = std::lower_bound(dictionary, last, u, [&](vertex_id id, const T& key) {
+        return names[id] < key;
+    });
+    return it != last && !(u < names[*it]) ? it : nullptr;
+}
+
+template<typename T>
+typename MappedCSRGraph<T>::vertex_id MappedCSRGraph<T>::id_of(const T& u) const {
+    const vertex_id* it = find(u);
+    if (!it) throw std::out_of_range("Vertex not in graph");
+    return *it;
+}
+
+template<typename T>
+const T& MappedCSRGraph<T>::vertex(vertex_id id) const {
+    if (id >= vertex_count()) throw std::out_of_range("Index out of bounds");
+    return names[id];
+}
+
+template<typename T>
+bool MappedCSRGraph<T>::has_edge(const T& u, const T& v) const {
+    const vertex_id *iu = find(u), *iv = find(v);
+    if (!iu || !iv) return false;
+    Span<const vertex_id> nbrs = neighbors(*iu);
+    return std::find(nbrs.begin(), nbrs.end(), *iv) != nbrs.end();
+}
+
+template<typename T>
+CSRGraph<T> MappedCSRGraph<T>::to_csr() const {
+    size_t n = vertex_count(), m = edge_count();
+    return CSRGraph<T>(std::vector<T>(names, names + n), std::vector<uint64_t>(offsets, offsets + n + 1),
+                       std::vector<vertex_id>(targets, targets + m), std::vector<int>(weights, weights + m),
+                       is_directed());
+}
+
+} // namespace MayDSA
+
+#endif // MAYDSA_GRAPH_IO_HPP
@@ -0,0 +1,243 @@
+#pragma once
+#ifndef MAYDSA_GRAPH_SEARCH_HPP
+#define MAYDSA_GRAPH_SEARCH_HPP
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include "flat_hash_map.hpp"
+
+namespace MayDSA {
+
+/**
+ * @brief No-op base for depth-first visitors.
+ *
+ * Derive from it and redeclare only the hooks you need; the search engine is
+ * a template over the visitor type, so every call is resolved at compile time
+ * and unused hooks inline away. The vertex type is T for Graph<T> and the
+ * dense id for CSRGraph. done() is polled after every hook to stop early.
+ */
+struct DFSVisitor {
+    template<typename V> void start_vertex(const V&) {}     // New search root
+    template<typename V> void discover_vertex(const V&) {}  // Pre-order
+    template<typename V> void finish_vertex(const V&) {}    // Post-order
+    template<typename V> void tree_edge(const V&, const V&, int) {}
+    template<typename V> void back_edge(const V&, const V&, int) {}  // Target is on the current path
+    template<typename V> void forward_or_cross_edge(const V&, const V&, int) {}
+    bool done() const { return false; }
+};
+
+namespace detail {
+
+enum class Color : uint8_t { white, grey, black };
+
+/**
+ * Iterative depth-first search from root. The adaptor supplies the vertex
+ * and edge-iterator types, color()/set_color(), out_edges(v) as a begin/end
+ * pair, and target()/weight() of an edge iterator. Returns false if the
+ * visitor stopped the search.
+ */
+template<typename Adaptor, typename Visitor>
+bool dfs_visit(Adaptor& g, const typename Adaptor::vertex& root, Visitor& vis) {
+    using Vertex = typename Adaptor::vertex;
+    using EdgeIt = typename Adaptor::edge_iterator;
+    struct Frame {
+        Vertex v;
+        EdgeIt next;
+        EdgeIt end;
+    };
+
+    std::vector<Frame> stack;
+    auto enter = [&](const Vertex& v) {
+        g.set_color(v, Color::grey);
+        vis.discover_vertex(v);
+        auto [first, last] = g.out_edges(v);
+        stack.push_back({v, first, last});
+    };
+
+    enter(root);
+    if (vis.done()) return false;
+    while (!stack.empty()) {
+        Frame& f = stack.back();
+        if (f.next == f.end) {
+            Vertex v = std::move(f.v);
+            stack.pop_back();
+            g.set_color(v, Color::black);
+            vis.finish_vertex(v);
+        } else {
+            EdgeIt e = f.next++;
+            const Vertex& w = g.target(e);
+            Color c = g.color(w);
+            if (c == Color::white) {
+                vis.tree_edge(f.v, w, g.weight(e));
+                enter(w);  // May reallocate the stack; f is not used past this point
+            } else if (c == Color::grey) {
+                vis.back_edge(f.v, w, g.weight(e));
+            } else {
+                vis.forward_or_cross_edge(f.v, w, g.weight(e));
+            }
+        }
+        if (vis.done()) return false;
+    }
+    return true;
+}
+
+// Stops at the first cycle. Undirected graphs ignore the arc back to the DFS
+// parent, since that is the tree edge itself seen from the other side.
+template<typename V>
+struct CycleVisitor : DFSVisitor {
+    bool directed;
+    bool found = false;
+    std::vector<V> path;  // Grey vertices, root first
+
+    explicit CycleVisitor(bool isDirected) : directed(isDirected) {}
+
+    void discover_vertex(const V& v) { path.push_back(v); }
+    void finish_vertex(const V&) { path.pop_back(); }
+    void back_edge(const V&, const V& w, int) {
+        if (directed || path.size() < 2 || !(w == path[path.size() - 2])) found = true;
+    }
+    bool done() const { return found; }
+};
+
+// Stops once target is discovered
+template<typename V>
+struct ReachVisitor : DFSVisitor {
+    const V& target;
+    bool found = false;
+
+    explicit ReachVisitor(const V& t) : target(t) {}
+
+    void discover_vertex(const V& v) { found |= v == target; }
+    bool done() const { return found; }
+};
+
+/**
+ * Topological order kept up to date under arc insertions, for Graph's
+ * incremental mode. Vertices carry integer keys with gaps between them, in
+ * an ordered map, so a vertex can be moved between two others without
+ * renumbering the rest; when a gap runs out, a window of neighbours around
+ * it is respaced, growing until the window is sparse enough.
+ *
+ * insert_arc(x, y) does nothing when x already precedes y. Otherwise it
+ * searches forward from y, confined to vertices ordered before x (reaching
+ * x means a cycle), and moves the reached set, in its current relative
+ * order, to just after x. This is the forward half of Pearce and Kelly's
+ * search (Graph keeps no in-arcs for the backward half); its cost is
+ * bounded by the reached set and its out-arcs, not by V + E.
+ */
+template<typename T>
+class IncrementalOrder {
+private:
+    static constexpr long long spacing = 1LL << 20;  // Gap left between fresh keys
+
+    std::map<long long, T> at;  // Key -> vertex, in topological order
+    FlatHashMap<T, long long> key;
+
+    void assign(long long k, T v) {
+        key[v] = k;
+        at.emplace(k, std::move(v));
+    }
+
+    // Insert moved (already removed from at) directly after x
+    void place_after(const T& x, std::vector<T>& moved) {
+        auto xit = at.find(key.at(x));
+        auto next = std::next(xit);
+        size_t m = moved.size();
+        if (next == at.end() || static_cast<size_t>(next->first - xit->first) > m) {
+            long long step = next == at.end() ? spacing : (next->first - xit->first) / static_cast<long long>(m + 1);
+            long long k = xit->first;
+            for (T& v : moved) assign(k += step, std::move(v));
+            return;
+        }
+
+        // Gap exhausted: widen a window [lo, hi) around x until it has room to spare, then respace it
+        auto lo = xit, hi = next;
+        size_t count = 1;
+        while (hi != at.end() && static_cast<size_t>((hi->first - lo->first) / 64) < count + m) {
+            for (size_t i = 0; i < count && lo != at.begin(); ++i) --lo;
+            for (size_t i = 0; i < count && hi != at.end(); ++i) ++hi;
+            count = static_cast<size_t>(std::distance(lo, hi));
+        }
+        long long base = lo->first;
+        long long step = hi == at.end() ? spacing : (hi->first - base) / static_cast<long long>(count + m);
+        std::vector<T> window;
+        window.reserve(count + m);
+        for (auto it = lo; it != hi; ++it) {
+            window.push_back(std::move(it->second));
+            if (it == xit)
+                for (T& v : moved) window.push_back(std::move(v));
+        }
+        at.erase(lo, hi);
+        long long k = base;
+        for (T& v : window) {
+            assign(k, std::move(v));
+            k += step;
+        }
+    }
+
+public:
+    bool contains(const T& v) const {
+        return key.contains(v);
+    }
+
+    // New vertices: one without in-arcs may go first, anything may go last
+    void push_front(const T& v) {
+        assign(at.empty() ? 0 : at.begin()->first - spacing, v);
+    }
+
+    void push_back(const T& v) {
+        assign(at.empty() ? 0 : at.rbegin()->first + spacing, v);
+    }
+
+    void erase(const T& v) {
+        auto it = key.find(v);
+        if (it == key.end()) return;
+        at.erase(it->second);
+        key.erase(v);
+    }
+
+    std::vector<T> order() const {
+        std::vector<T> result;
+        result.reserve(at.size());
+        for (const auto& [_, v] : at) result.push_back(v);
+        return result;
+    }
+
+    /**
+     * Make room for the arc x -> y, which the caller adds only on success.
+     * out(v) must return v's out-arcs as a range of (target, weight) pairs.
+     * Returns false, leaving the order untouched, if y reaches x (the arc
+     * would close a cycle).
+     */
+    template<typename OutArcs>
+    bool insert_arc(const T& x, const T& y, OutArcs&& out) {
+        if (x == y) return false;
+        long long lb = key.at(y), ub = key.at(x);
+        if (ub < lb) return true;
+
+        // Successors of y already sit after it, so only ub bounds the search
+        std::vector<T> reached{y};
+        FlatHashMap<T, bool> seen;
+        seen.try_emplace(y, true);
+        for (size_t i = 0; i < reached.size(); ++i) {
+            for (const auto& arc : out(reached[i])) {
+                long long k = key.at(arc.first);
+                if (k == ub) return false;
+                if (k < ub && seen.try_emplace(arc.first, true).second) reached.push_back(arc.first);
+            }
+        }
+
+        std::sort(reached.begin(), reached.end(), [&](const T& a, const T& b) { return key.at(a) < key.at(b); });
+        for (const T& v : reached) at.erase(key.at(v));
+        place_after(x, reached);
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace MayDSA
+
+#endif // MAYDSA_GRAPH_SEARCH_HPP
@@ -0,0 +1,144 @@
+#pragma once
+#ifndef MAYDSA_HAZARD_POINTER_HPP
+#define MAYDSA_HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace MayDSA {
+
+/**
+ * @brief Hazard-pointer memory reclamation for the lock-free containers.
+ *
+ * A thread publishes the node it is about to dereference in one of its
+ * hazard slots; retired nodes are only freed once no slot holds them. Each
+ * thread claims a record on first use and returns it at thread exit. Nodes
+ * still protected at that point are handed to a shared orphan list that the
+ * next scan in any thread picks up.
+ */
+namespace hazard {
+
+constexpr size_t max_threads = 256;
+constexpr size_t slots_per_thread = 2;
+// Scan once a thread has this many retired nodes (amortizes the O(H) scan)
+constexpr size_t scan_threshold = 2 * max_threads * slots_per_thread;
+
+struct alignas(64) Record {
+    std::atomic<bool> active{false};
+    std::atomic<void*> slots[slots_per_thread] = {};
+};
+
+struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+};
+
+inline Record records[max_threads];
+inline std::mutex orphan_mutex;
+inline std::vector<Retired> orphans;
+
+// Free every retired node not currently published in a hazard slot
+inline void scan(std::vector<Retired>& retired) {
+    {
+        std::lock_guard<std::mutex> lock(orphan_mutex);
+        if (!orphans.empty()) {
+            retired.insert(retired.end(), orphans.begin(), orphans.end());
+            orphans.clear();
+        }
+    }
+    std::vector<void*> hazards;
+    hazards.reserve(max_threads * slots_per_thread);
+    // Pairs with the fence in protect()/set(): a node unlinked before this
+    // point is either seen in a slot here or seen as unlinked by the reader
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Record& r : records) {
+        if (!r.active.load(std::memory_order_acquire)) continue;
+        for (auto& s : r.slots)
+            if (void* p = s.load(std::memory_order_seq_cst)) hazards.push_back(p);
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    size_t kept = 0;
+    for (Retired& r : retired) {
+        if (std::binary_search(hazards.begin(), hazards.end(), r.ptr))
+            retired[kept++] = r;
+        else
+            r.deleter(r.ptr);
+    }
+    retired.resize(kept);
+}
+
+class ThreadState {
+    Record* rec;
+    std::vector<Retired> retired;
+
+public:
+    ThreadState(): rec(nullptr) {
+        for (Record& r : records) {
+            bool expected = false;
+            if (!r.active.load(std::memory_order_relaxed)
+                && r.active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                rec = &r;
+                return;
+            }
+        }
+        throw std::runtime_error("Too many threads using hazard pointers");
+    }
+
+    ~ThreadState() {
+        for (auto& s : rec->slots) s.store(nullptr, std::memory_order_release);
+        scan(retired);
+        if (!retired.empty()) {
+            std::lock_guard<std::mutex> lock(orphan_mutex);
+            orphans.insert(orphans.end(), retired.begin(), retired.end());
+        }
+        rec->active.store(false, std::memory_order_release);
+    }
+
+    ThreadState(const ThreadState&) = delete;
+    ThreadState& operator=(const ThreadState&) = delete;
+
+    // Publish src's current value in slot i and return it once it is stable
+    template<typename Node>
+    Node* protect(size_t i, const std::atomic<Node*>& src) {
+        Node* p = src.load(std::memory_order_relaxed);
+        while (true) {
+            rec->slots[i].store(p, std::memory_order_seq_cst);
+            // Store-load barrier: the unlinking CASes are only acq_rel
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            Node* again = src.load(std::memory_order_acquire);
+            if (again == p) return p;
+            p = again;
+        }
+    }
+
+    // Publish p in slot i; the caller re-validates p afterwards
+    void set(size_t i, void* p) {
+        rec->slots[i].store(p, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void clear() {
+        for (auto& s : rec->slots) s.store(nullptr, std::memory_order_release);
+    }
+
+    template<typename Node>
+    void retire(Node* p) {
+        retired.push_back({p, [](void* q) { delete static_cast<Node*>(q); }});
+        if (retired.size() >= scan_threshold) scan(retired);
+    }
+};
+
+inline ThreadState& local() {
+    thread_local ThreadState state;
+    return state;
+}
+
+} // namespace hazard
+} // namespace MayDSA
+
+#endif // MAYDSA_HAZARD_POINTER_HPP
@@ -3,63 +3,411 @@
 #define MAYDSA_HEAP_HPP
 
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 #include <functional>
 #include <iostream>
+#include <utility>
+#include <new>
+#include <type_traits>
+#include <limits>
 
 namespace MayDSA {
 
-template<typename T, typename Compare = std::less<T>>
+namespace detail {
+
+constexpr size_t cache_line = 64;
+
+// Minimal allocator handing out cache-line-aligned blocks
+template<typename T>
+struct CacheAlignedAllocator {
+    using value_type = T;
+
+    CacheAlignedAllocator() = default;
+    template<typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(cache_line)));
+    }
+
+    void deallocate(T* p, size_t) {
+        ::operator delete(p, std::align_val_t(cache_line));
+    }
+
+    template<typename U>
+    bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+    template<typename U>
+    bool operator!=(const CacheAlignedAllocator<U>&) const { return false; }
+};
+
+} // namespace detail
+
+/**
+ * @brief D-ary heap; the element for which Compare holds against all others is on top.
+ *
+ * Sifting is hole-based: the moving element is held aside and each level
+ * costs one move instead of a three-move swap. With Aligned = true the array
+ * is cache-line aligned and padded by D - 1 slots so the D children of a node
+ * start on a cache-line boundary (one line per sibling group when
+ * D * sizeof(T) == 64, e.g. 4-ary of 16-byte or 8-ary of 8-byte entries);
+ * that mode needs a default-constructible T for the padding.
+ *
+ * @tparam D Arity (children per node), at least 2.
+ */
+template<typename T, typename Compare = std::less<T>, size_t D = 2, bool Aligned = false>
 class Heap {
+    static_assert(D >= 2, "Heap arity must be at least 2");
+    static_assert(!Aligned || std::is_default_constructible<T>::value,
+                  "Aligned Heap needs a default-constructible T for padding");
+
+private:
+    using Storage = std::conditional_t<Aligned, std::vector<T, detail::CacheAlignedAllocator<T>>, std::vector<T>>;
+    static constexpr size_t pad = Aligned ? D - 1 : 0;
+
+    Storage data;  // Logical element i lives at data[i + pad]
+    Compare comp;
+
+    T* base() { return data.data() + pad; }
+    const T* base() const { return data.data() + pad; }
+
+    void heapify_up(size_t idx) {
+        T* a = base();
+        T moving = std::move(a[idx]);
+        while (idx > 0) {
+            size_t parent = (idx - 1) / D;
+            if (!comp(moving, a[parent])) break;
+            a[idx] = std::move(a[parent]);
+            idx = parent;
+        }
+        a[idx] = std::move(moving);
+    }
+
+    void heapify_down(size_t idx) {
+        T* a = base();
+        size_t size = this->size();
+        T moving = std::move(a[idx]);
+        while (true) {
+            size_t first = D * idx + 1;
+            if (first >= size) break;
+            size_t last = first + D < size ? first + D : size;
+            size_t best = first;
+            for (size_t c = first + 1; c < last; ++c)
+                if (comp(a[c], a[best])) best = c;
+            if (!comp(a[best], moving)) break;
+            a[idx] = std::move(a[best]);
+            idx = best;
+        }
+        a[idx] = std::move(moving);
+    }
+
+    // Floyd's bottom-up construction: sift down every internal node, O(n)
+    void heapify_all() {
+        size_t n = size();
+        if (n < 2) return;
+        for (size_t i = (n - 2) / D + 1; i-- > 0;) heapify_down(i);
+    }
+
+    // Restore the heap after elements were appended at [old_size, size())
+    void fix_appended(size_t old_size) {
+        size_t added = size() - old_size;
+        // Sifting each one up costs O(added log n); rebuilding costs O(n)
+        if (added > old_size) heapify_all();
+        else
+            for (size_t i = old_size; i < size(); ++i) heapify_up(i);
+    }
+
+public:
+    static constexpr size_t arity = D;
+
+    Heap() {
+        data.resize(pad);
+    }
+
+    // Build from [first, last) in O(n)
+    template<typename InputIt>
+    Heap(InputIt first, InputIt last) {
+        data.resize(pad);
+        data.insert(data.end(), first, last);
+        heapify_all();
+    }
+
+    void push(const T& val) {
+        data.push_back(val);
+        heapify_up(size() - 1);
+    }
+
+    void push(T&& val) {
+        data.push_back(std::move(val));
+        heapify_up(size() - 1);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        data.emplace_back(std::forward<Args>(args)...);
+        heapify_up(size() - 1);
+    }
+
+    // Add every element of [first, last), re-heapifying in bulk when that is cheaper
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last) {
+        size_t old_size = size();
+        data.insert(data.end(), first, last);
+        fix_appended(old_size);
+    }
+
+    void pop() {
+        if (empty()) throw std::out_of_range("Heap is empty");
+        T* a = base();
+        size_t last = size() - 1;
+        if (last > 0) a[0] = std::move(a[last]);
+        data.pop_back();
+        if (!empty()) heapify_down(0);
+    }
+
+    // Remove the top and return it by move
+    T pop_value() {
+        if (empty()) throw std::out_of_range("Heap is empty");
+        T* a = base();
+        T result = std::move(a[0]);
+        size_t last = size() - 1;
+        if (last > 0) a[0] = std::move(a[last]);
+        data.pop_back();
+        if (!empty()) heapify_down(0);
+        return result;
+    }
+
+    /**
+     * @brief Copy of the k best elements in pop order, leaving the heap untouched.
+     *
+     * Walks the heap best-first with a small frontier of candidate slots, so
+     * only O(k log k) comparisons are made however large the heap is.
+     */
+    std::vector<T> top_k(size_t k) const {
+        std::vector<T> out;
+        if (k > size()) k = size();
+        if (k == 0) return out;
+        out.reserve(k);
+
+        const T* a = base();
+        // std heap algorithms keep the max on top, so invert comp to surface the best slot
+        auto worse = [&](size_t x, size_t y) { return comp(a[y], a[x]); };
+        std::vector<size_t> frontier;
+        frontier.reserve(k * (D - 1) + 1);
+        frontier.push_back(0);
+        size_t n = size();
+        while (out.size() < k) {
+            std::pop_heap(frontier.begin(), frontier.end(), worse);
+            size_t idx = frontier.back();
+            frontier.pop_back();
+            out.push_back(a[idx]);
+            for (size_t c = D * idx + 1; c <= D * idx + D && c < n; ++c) {
+                frontier.push_back(c);
+                std::push_heap(frontier.begin(), frontier.end(), worse);
+            }
+        }
+        return out;
+    }
+
+    void reserve(size_t n) {
+        data.reserve(n + pad);
+    }
+
+    const T& top() const {
+        if (empty()) throw std::out_of_range("Heap is empty");
+        return base()[0];
+    }
+
+    size_t size() const {
+        return data.size() - pad;
+    }
+
+    bool empty() const {
+        return data.size() == pad;
+    }
+
+    void clear() {
+        data.resize(pad);
+    }
+
+    void print() const {
+        std::cout << "[ ";
+        for (size_t i = 0; i < size(); ++i) std::cout << base()[i] << " ";
+        std::cout << "]\n";
+    }
+};
+
+/**
+ * @brief Binary heap whose entries can be located, re-keyed and erased.
+ *
+ * push() returns a stable handle that stays valid until that entry is popped
+ * or erased. Slots are then recycled, but each reuse bumps the slot's
+ * generation, which is part of the handle, so a stale handle is reported by
+ * contains() and rejected by the other calls instead of reaching the new
+ * entry. A position map from slot to heap index is kept in sync by the sift
+ * routines, so decrease_key/increase_key/update/erase run in O(log n) and
+ * the heap never has to hold stale copies.
+ */
+template<typename T, typename Compare = std::less<T>>
+class AddressableHeap {
+public:
+    using handle = size_t;
+
 private:
-    std::vector<T> data;
+    struct Entry {
+        T value;
+        size_t slot;
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    // Low half of a handle is the slot, high half its generation (wraps
+    // after 2^32 reuses of one slot on 64-bit targets)
+    static constexpr size_t slot_bits = std::numeric_limits<size_t>::digits / 2;
+    static constexpr size_t slot_mask = (size_t(1) << slot_bits) - 1;
+
+    std::vector<Entry> data;
+    std::vector<size_t> pos;          // slot -> index in data, npos if free
+    std::vector<size_t> generation;   // slot -> generation of its current or next handle
+    std::vector<size_t> free_slots;
     Compare comp;
 
+    handle make_handle(size_t slot) const {
+        return slot | (generation[slot] << slot_bits);
+    }
+
+    // Hole-based sift: carry the moving entry and shift others into the hole
     void heapify_up(size_t idx) {
+        Entry moving = std::move(data[idx]);
         while (idx > 0) {
             size_t parent = (idx - 1) / 2;
-            if (comp(data[idx], data[parent])) {
-                std::swap(data[idx], data[parent]);
-                idx = parent;
-            } else break;
+            if (!comp(moving.value, data[parent].value)) break;
+            data[idx] = std::move(data[parent]);
+            pos[data[idx].slot] = idx;
+            idx = parent;
         }
+        data[idx] = std::move(moving);
+        pos[data[idx].slot] = idx;
     }
 
     void heapify_down(size_t idx) {
         size_t size = data.size();
+        Entry moving = std::move(data[idx]);
         while (true) {
             size_t left = 2 * idx + 1;
-            size_t right = 2 * idx + 2;
-            size_t best = idx;
+            if (left >= size) break;
+            size_t best = left;
+            if (left + 1 < size && comp(data[left + 1].value, data[left].value)) best = left + 1;
+            if (!comp(data[best].value, moving.value)) break;
+            data[idx] = std::move(data[best]);
+            pos[data[idx].slot] = idx;
+            idx = best;
+        }
+        data[idx] = std::move(moving);
+        pos[data[idx].slot] = idx;
+    }
 
-            if (left < size && comp(data[left], data[best])) best = left;
-            if (right < size && comp(data[right], data[best])) best = right;
+    size_t index_of(handle h) const {
+        if (!contains(h)) throw std::out_of_range("Invalid heap handle");
+        return pos[h & slot_mask];
+    }
 
-            if (best == idx) break;
+    // Detach the entry at idx and restore the heap property
+    void remove_at(size_t idx) {
+        size_t slot = data[idx].slot;
+        pos[slot] = npos;
+        generation[slot] = (generation[slot] + 1) & slot_mask;
+        free_slots.push_back(slot);
+        if (idx + 1 == data.size()) {
+            data.pop_back();
+            return;
+        }
+        data[idx] = std::move(data.back());
+        data.pop_back();
+        pos[data[idx].slot] = idx;
+        // The replacement may need to move either way
+        if (idx > 0 && comp(data[idx].value, data[(idx - 1) / 2].value)) heapify_up(idx);
+        else heapify_down(idx);
+    }
 
-            std::swap(data[idx], data[best]);
-            idx = best;
+    handle emplace_entry(T&& val) {
+        size_t slot;
+        if (!free_slots.empty()) {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        } else {
+            if (pos.size() > slot_mask) throw std::length_error("AddressableHeap handle space exhausted");
+            slot = pos.size();
+            pos.push_back(npos);
+            generation.push_back(0);
         }
+        data.push_back({std::move(val), slot});
+        heapify_up(data.size() - 1);
+        return make_handle(slot);
     }
 
 public:
-    Heap() = default;
+    AddressableHeap() = default;
 
-    void push(const T& val) {
-        data.push_back(val);
-        heapify_up(data.size() - 1);
+    handle push(const T& val) {
+        return emplace_entry(T(val));
+    }
+
+    handle push(T&& val) {
+        return emplace_entry(std::move(val));
     }
 
     void pop() {
         if (data.empty()) throw std::out_of_range("Heap is empty");
-        std::swap(data[0], data.back());
-        data.pop_back();
-        if (!data.empty()) heapify_down(0);
+        remove_at(0);
     }
 
     const T& top() const {
         if (data.empty()) throw std::out_of_range("Heap is empty");
-        return data[0];
+        return data[0].value;
+    }
+
+    handle top_handle() const {
+        if (data.empty()) throw std::out_of_range("Heap is empty");
+        return make_handle(data[0].slot);
+    }
+
+    // True while h refers to an entry still in the heap
+    bool contains(handle h) const {
+        size_t slot = h & slot_mask;
+        return slot < pos.size() && pos[slot] != npos && generation[slot] == (h >> slot_bits);
+    }
+
+    const T& get(handle h) const {
+        return data[index_of(h)].value;
+    }
+
+    // Move h toward the top; newval must not compare worse than the current value
+    void decrease_key(handle h, const T& newval) {
+        size_t idx = index_of(h);
+        if (comp(data[idx].value, newval)) throw std::invalid_argument("decrease_key would move the entry down");
+        data[idx].value = newval;
+        heapify_up(idx);
+    }
+
+    // Move h away from the top; newval must not compare better than the current value
+    void increase_key(handle h, const T& newval) {
+        size_t idx = index_of(h);
+        if (comp(newval, data[idx].value)) throw std::invalid_argument("increase_key would move the entry up");
+        data[idx].value = newval;
+        heapify_down(idx);
+    }
+
+    // Replace h's value, sifting in whichever direction is needed
+    void update(handle h, const T& newval) {
+        size_t idx = index_of(h);
+        bool up = comp(newval, data[idx].value);
+        data[idx].value = newval;
+        if (up) heapify_up(idx);
+        else heapify_down(idx);
+    }
+
+    void erase(handle h) {
+        remove_at(index_of(h));
     }
 
     size_t size() const {
@@ -70,13 +418,19 @@ public:
         return data.empty();
     }
 
+    // Outstanding handles stay invalid: every live slot moves to a new generation
     void clear() {
+        for (const Entry& e : data) {
+            pos[e.slot] = npos;
+            generation[e.slot] = (generation[e.slot] + 1) & slot_mask;
+            free_slots.push_back(e.slot);
+        }
         data.clear();
     }
 
     void print() const {
         std::cout << "[ ";
-        for (const auto& x : data) std::cout << x << " ";
+        for (const auto& e : data) std::cout << e.value << " ";
         std::cout << "]\n";
     }
 };
@@ -3,7 +3,10 @@
 
 #include <iostream>
 #include <stdexcept>
-#include <unordered_set>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include "node_pool.hpp"
 
 namespace MayDSA{
 
@@ -19,10 +22,15 @@ private:
     Node* head;
     Node* tail;
     size_t length;
+    NodePool<Node> pool;  // Nodes are carved from slabs and freed in bulk
 
 public:
     // Constructor and destructor
     LinkedList(): head(nullptr), tail(nullptr), length(0) {}
+    explicit LinkedList(std::pmr::memory_resource* mr): head(nullptr), tail(nullptr), length(0), pool(mr) {}
+    LinkedList(const LinkedList& other);
+    LinkedList(LinkedList&& other) noexcept;
+    LinkedList& operator=(LinkedList other) noexcept;
     ~LinkedList();
 
     // Core operations
@@ -42,24 +50,51 @@ public:
     void print() const;
 };
 
+template<typename T>
+MayDSA::LinkedList<T>::LinkedList(const LinkedList& other)
+    : head(nullptr), tail(nullptr), length(0), pool(other.pool.get_resource()) {
+    Node* curr = other.head;
+    for (size_t i = 0; i < other.length; ++i, curr = curr->next) push_back(curr->data);
+}
+
+template<typename T>
+MayDSA::LinkedList<T>::LinkedList(LinkedList&& other) noexcept
+    : head(other.head), tail(other.tail), length(other.length), pool(std::move(other.pool)) {
+    other.head = other.tail = nullptr;
+    other.length = 0;
+}
+
+template<typename T>
+MayDSA::LinkedList<T>& MayDSA::LinkedList<T>::operator=(LinkedList other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(length, other.length);
+    pool.swap(other.pool);
+    return *this;
+}
+
 template<typename T>
 MayDSA::LinkedList<T>::~LinkedList() {
-    std::unordered_set<Node*> visited;
-    while (head) {
-        if (visited.count(head)) break; // Detected cycle, stop
-        visited.insert(head);
-        Node* temp = head;
-        head = head->next;
-        delete temp;
+    // Every node came from the pool, so one sweep frees them all. Element
+    // destructors only need a walk bounded by length, which also stops a
+    // cycle (made through accessHead) from looping forever.
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        Node* curr = head;
+        for (size_t i = 0; i < length && curr; ++i) {
+            Node* next = curr->next;
+            curr->~Node();
+            curr = next;
+        }
     }
-    tail = nullptr;
+    pool.release();
+    head = tail = nullptr;
     length = 0;
 }
 
 
 template<typename T>
 void MayDSA::LinkedList<T>::push_front(const T& val) {
-    Node* new_node = new Node(val);
+    Node* new_node = pool.create(val);
     new_node->next = head;
     head = new_node;
     if (tail == nullptr) tail = head;
@@ -68,7 +103,7 @@ void MayDSA::LinkedList<T>::push_front(const T& val) {
 
 template<typename T>
 void MayDSA::LinkedList<T>::push_back(const T& val) {
-    Node* new_node = new Node(val);
+    Node* new_node = pool.create(val);
     if (tail) {
         tail->next = new_node;
         tail = new_node;
@@ -83,7 +118,7 @@ void MayDSA::LinkedList<T>::pop_front() {
     if (!head) throw std::out_of_range("List is empty");
     Node* temp = head;
     head = head->next;
-    delete temp;
+    pool.destroy(temp);
     if (!head) tail = nullptr;
     --length;
 }
@@ -92,12 +127,12 @@ template<typename T>
 void MayDSA::LinkedList<T>::pop_back() {
     if (!head) throw std::out_of_range("List is empty");
     if (head == tail) {
-        delete head;
+        pool.destroy(head);
         head = tail = nullptr;
     } else {
         Node* curr = head;
         while (curr->next != tail) curr = curr->next;
-        delete tail;
+        pool.destroy(tail);
         tail = curr;
         tail->next = nullptr;
     }
@@ -113,7 +148,7 @@ void MayDSA::LinkedList<T>::insert(size_t pos, const T& val) {
 
     Node* curr = head;
     for (size_t i = 0; i < pos - 1; ++i) curr = curr->next;
-    Node* new_node = new Node(val);
+    Node* new_node = pool.create(val);
     new_node->next = curr->next;
     curr->next = new_node;
     ++length;
@@ -129,7 +164,7 @@ void MayDSA::LinkedList<T>::remove(size_t pos) {
     Node* temp = curr->next;
     curr->next = temp->next;
     if (temp == tail) tail = curr;
-    delete temp;
+    pool.destroy(temp);
     --length;
 }
 
@@ -0,0 +1,280 @@
+#pragma once
+#ifndef MAYDSA_MAPPED_VECTOR_HPP
+#define MAYDSA_MAPPED_VECTOR_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vector.hpp"
+
+/**
+ * @brief File-backed dynamic array for trivially copyable T (POSIX only).
+ *
+ * Elements live in an mmap'd file laid out as a 64-byte header followed by the
+ * raw array, so reopening the file is zero-copy: nothing is parsed or
+ * rebuilt. The element count is kept in the mapped header and is updated on
+ * every mutation. Call sync() to force dirty pages to disk. Growth extends the
+ * file with ftruncate and remaps it (mremap on Linux), which invalidates
+ * pointers, iterators and spans.
+ *
+ * @tparam T Trivially copyable element type.
+ */
+namespace MayDSA {
+
+template<typename T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector requires a trivially copyable T");
+
+private:
+    struct Header {
+        char magic[8];       // "MAYDSAMV"
+        uint64_t elem_size;  // sizeof(T) when the file was created
+        uint64_t length;     // Number of elements stored
+        uint64_t reserved[5];
+    };
+    static_assert(sizeof(Header) == 64, "MappedVector header must stay 64 bytes");
+
+    int fd;
+    void* base;       // Start of the mapping (header)
+    size_t capacity;  // Element slots available in the file
+    std::string path;
+
+    Header* header() const { return static_cast<Header*>(base); }
+    T* buffer() const { return reinterpret_cast<T*>(static_cast<char*>(base) + sizeof(Header)); }
+
+    static size_t bytes_for(size_t n) { return sizeof(Header) + n * sizeof(T); }
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error("MappedVector(" + path + "): " + what + ": " + std::strerror(errno));
+    }
+
+    // Release the file and mapping, then report the pending errno
+    [[noreturn]] void fail_and_close(const std::string& what) {
+        int err = errno;
+        close();
+        errno = err;
+        fail(what);
+    }
+
+    void remap(size_t new_capacity) {
+        size_t old_bytes = bytes_for(capacity), new_bytes = bytes_for(new_capacity);
+        if (::ftruncate(fd, static_cast<off_t>(new_bytes)) != 0) fail("ftruncate failed");
+#ifdef MREMAP_MAYMOVE
+        void* p = ::mremap(base, old_bytes, new_bytes, MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) fail("mremap failed");
+#else
+        ::munmap(base, old_bytes);
+        void* p = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) {
+            base = nullptr;
+            fail("mmap failed");
+        }
+#endif
+        base = p;
+        capacity = new_capacity;
+    }
+
+    void grow() {
+        size_t min_slots = std::max<size_t>(1, 4096 / sizeof(T));
+        remap(std::max(capacity * 2, min_slots));
+    }
+
+    void close() {
+        if (base) ::munmap(base, bytes_for(capacity));
+        if (fd >= 0) ::close(fd);
+        base = nullptr;
+        fd = -1;
+        capacity = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * @brief Open path, creating it if missing.
+     *
+     * @param truncate Discard any existing contents instead of reopening them.
+     */
+    explicit MappedVector(const std::string& filename, bool truncate = false)
+        : fd(-1), base(nullptr), capacity(0), path(filename) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+        if (fd < 0) fail("open failed");
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) fail_and_close("fstat failed");
+        size_t file_bytes = static_cast<size_t>(st.st_size);
+        bool fresh = file_bytes == 0;
+        if (fresh) {
+            file_bytes = bytes_for(0);
+            if (::ftruncate(fd, static_cast<off_t>(file_bytes)) != 0) fail_and_close("ftruncate failed");
+        } else if (file_bytes < sizeof(Header)) {
+            close();
+            throw std::runtime_error("MappedVector(" + path + "): file too small to be a MappedVector");
+        }
+
+        base = ::mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            base = nullptr;
+            fail_and_close("mmap failed");
+        }
+        capacity = (file_bytes - sizeof(Header)) / sizeof(T);
+
+        if (fresh) {
+            std::memcpy(header()->magic, "MAYDSAMV", 8);
+            header()->elem_size = sizeof(T);
+            header()->length = 0;
+        } else if (std::memcmp(header()->magic, "MAYDSAMV", 8) != 0 || header()->elem_size != sizeof(T)
+                   || header()->length > capacity) {
+            close();
+            throw std::runtime_error("MappedVector(" + path + "): not a MappedVector of this element type");
+        }
+    }
+
+    ~MappedVector() {
+        close();
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : fd(other.fd), base(other.base), capacity(other.capacity), path(std::move(other.path)) {
+        other.fd = -1;
+        other.base = nullptr;
+        other.capacity = 0;
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(fd, other.fd);
+            std::swap(base, other.base);
+            std::swap(capacity, other.capacity);
+            std::swap(path, other.path);
+        }
+        return *this;
+    }
+
+    // Access operator (unchecked)
+    T& operator[](size_t index) { return buffer()[index]; }
+    const T& operator[](size_t index) const { return buffer()[index]; }
+
+    // Bounds-checked access
+    T& at(size_t index) {
+        if (index >= size()) throw std::out_of_range("Index out of bounds");
+        return buffer()[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size()) throw std::out_of_range("Index out of bounds");
+        return buffer()[index];
+    }
+
+    T* data() { return buffer(); }
+    const T* data() const { return buffer(); }
+
+    T* begin() { return buffer(); }
+    T* end() { return buffer() + size(); }
+    const T* begin() const { return buffer(); }
+    const T* end() const { return buffer() + size(); }
+
+    Span<T> span() { return Span<T>(buffer(), size()); }
+    Span<const T> span() const { return Span<const T>(buffer(), size()); }
+
+    // Add element to end
+    void push_back(const T& value) {
+        size_t n = size();
+        if (n == capacity) {
+            T tmp = value;  // value may live inside the mapping we are about to move
+            grow();
+            buffer()[n] = tmp;
+        } else {
+            buffer()[n] = value;
+        }
+        header()->length = n + 1;
+    }
+
+    // Remove last element
+    void pop_back() {
+        if (size() == 0) throw std::underflow_error("Vector is empty");
+        header()->length--;
+    }
+
+    // Make room for at least n elements without changing size
+    void reserve(size_t n) {
+        if (n > capacity) remap(n);
+    }
+
+    // Shrink the file to exactly the stored elements
+    void shrink_to_fit() {
+        if (size() < capacity) remap(size());
+    }
+
+    size_t size() const {
+        return static_cast<size_t>(header()->length);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    const std::string& filename() const {
+        return path;
+    }
+
+    // Clear all elements (file keeps its capacity)
+    void clear() {
+        header()->length = 0;
+    }
+
+    // Find first index of value, or npos
+    size_t find(const T& value) const {
+        return simd::find(buffer(), size(), value);
+    }
+
+    size_t count(const T& value) const {
+        return simd::count(buffer(), size(), value);
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != npos;
+    }
+
+    // Flush dirty pages to the file; blocks until written
+    void sync() {
+        if (::msync(base, bytes_for(capacity), MS_SYNC) != 0) fail("msync failed");
+    }
+
+    // Print vector
+    void print() const {
+        std::cout << "[ ";
+        for (size_t i = 0; i < size(); ++i)
+            std::cout << buffer()[i] << " ";
+        std::cout << " ]\n";
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_MAPPED_VECTOR_HPP
@@ -3,9 +3,20 @@
 
 // All core data structures
 #include "vector.hpp"
+#include "small_vector.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+#include "mapped_vector.hpp"
+#endif
 #include "linked_list.hpp"
+#include "doubly_linked_list.hpp"
+#include "unrolled_list.hpp"
+#include "skip_list.hpp"
 #include "heap.hpp"
+#include "radix_heap.hpp"
 #include "graph.hpp"
+#if defined(__unix__) || defined(__APPLE__)
+#include "graph_io.hpp"
+#endif
 #include "dsu.hpp"    
 
 #endif // MAYDSA_HPP
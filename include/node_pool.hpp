@@ -0,0 +1,145 @@
+#pragma once
+#ifndef MAYDSA_NODE_POOL_HPP
+#define MAYDSA_NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <algorithm>
+
+namespace MayDSA {
+
+/**
+ * @brief Slab allocator for fixed-size list nodes.
+ *
+ * Nodes are carved out of geometrically growing slabs obtained from a
+ * std::pmr::memory_resource, so consecutive allocations are contiguous.
+ * Freed nodes go on an intrusive free list for reuse, and release() hands
+ * every slab back in one sweep without touching individual nodes. Not
+ * thread-safe.
+ *
+ * @tparam Node Node type the pool hands out.
+ */
+template<typename Node>
+class NodePool {
+private:
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Slab {
+        Slab* prev;
+        size_t bytes;
+    };
+
+    // Slots start at the first Slot-aligned offset after the slab header
+    static constexpr size_t slots_offset = (sizeof(Slab) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    static constexpr size_t slab_align = std::max(alignof(Slab), alignof(Slot));
+    static constexpr size_t min_slab_nodes = 64;
+    static constexpr size_t max_slab_nodes = 1 << 16;
+
+    std::pmr::memory_resource* resource;
+    Slab* slabs;        // Most recent slab; older ones chained through prev
+    Slot* free_list;    // Recycled slots
+    Slot* bump;         // Next never-used slot in the current slab
+    Slot* bump_end;
+    size_t next_slab_nodes;
+
+    void add_slab() {
+        size_t bytes = slots_offset + next_slab_nodes * sizeof(Slot);
+        void* raw = resource->allocate(bytes, slab_align);
+        Slab* slab = static_cast<Slab*>(raw);
+        slab->prev = slabs;
+        slab->bytes = bytes;
+        slabs = slab;
+        bump = reinterpret_cast<Slot*>(static_cast<char*>(raw) + slots_offset);
+        bump_end = bump + next_slab_nodes;
+        next_slab_nodes = std::min(next_slab_nodes * 2, max_slab_nodes);
+    }
+
+public:
+    explicit NodePool(std::pmr::memory_resource* mr = std::pmr::get_default_resource())
+        : resource(mr), slabs(nullptr), free_list(nullptr), bump(nullptr), bump_end(nullptr),
+          next_slab_nodes(min_slab_nodes) {}
+
+    ~NodePool() {
+        release();
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept
+        : resource(other.resource), slabs(other.slabs), free_list(other.free_list), bump(other.bump),
+          bump_end(other.bump_end), next_slab_nodes(other.next_slab_nodes) {
+        other.slabs = nullptr;
+        other.free_list = nullptr;
+        other.bump = other.bump_end = nullptr;
+        other.next_slab_nodes = min_slab_nodes;
+    }
+
+    void swap(NodePool& other) noexcept {
+        std::swap(resource, other.resource);
+        std::swap(slabs, other.slabs);
+        std::swap(free_list, other.free_list);
+        std::swap(bump, other.bump);
+        std::swap(bump_end, other.bump_end);
+        std::swap(next_slab_nodes, other.next_slab_nodes);
+    }
+
+    // Raw storage for one Node
+    void* allocate() {
+        if (free_list) {
+            Slot* s = free_list;
+            free_list = s->next;
+            return s;
+        }
+        if (bump == bump_end) add_slab();
+        return bump++;
+    }
+
+    // Return storage obtained from allocate()
+    void deallocate(void* p) {
+        Slot* s = static_cast<Slot*>(p);
+        s->next = free_list;
+        free_list = s;
+    }
+
+    template<typename... Args>
+    Node* create(Args&&... args) {
+        void* p = allocate();
+        try {
+            return ::new (p) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(p);
+            throw;
+        }
+    }
+
+    void destroy(Node* node) {
+        node->~Node();
+        deallocate(node);
+    }
+
+    // Free every slab at once; nodes must already be destroyed (or trivially destructible)
+    void release() {
+        while (slabs) {
+            Slab* prev = slabs->prev;
+            resource->deallocate(slabs, slabs->bytes, slab_align);
+            slabs = prev;
+        }
+        free_list = nullptr;
+        bump = bump_end = nullptr;
+        next_slab_nodes = min_slab_nodes;
+    }
+
+    std::pmr::memory_resource* get_resource() const {
+        return resource;
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_NODE_POOL_HPP
@@ -0,0 +1,98 @@
+#pragma once
+#ifndef MAYDSA_PARALLEL_HPP
+#define MAYDSA_PARALLEL_HPP
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <exception>
+
+namespace MayDSA {
+namespace detail {
+
+// Reusable barrier for a fixed group of threads (C++17 has no std::barrier)
+class Barrier {
+private:
+    std::mutex m;
+    std::condition_variable cv;
+    size_t count;
+    size_t waiting = 0;
+    size_t generation = 0;
+
+public:
+    explicit Barrier(size_t n) : count(n) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(m);
+        size_t gen = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            ++generation;
+            cv.notify_all();
+        } else {
+            cv.wait(lock, [&] { return gen != generation; });
+        }
+    }
+};
+
+// Run body(tid) for tid in [0, threads), the calling thread taking tid 0
+template<typename F>
+void run_threads(size_t threads, F&& body) {
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back([&body, t] { body(t); });
+    body(0);
+    for (auto& th : pool) th.join();
+}
+
+// run_threads for bodies that may throw: the first exception (by tid) is rethrown after all threads join
+template<typename F>
+void run_threads_rethrow(size_t threads, F&& body) {
+    std::vector<std::exception_ptr> errors(threads);
+    run_threads(threads, [&](size_t t) {
+        try {
+            body(t);
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    });
+    for (auto& e : errors)
+        if (e) std::rethrow_exception(e);
+}
+
+// Sort [first, last) with up to `threads` threads: sort equal chunks, then merge pairwise
+template<typename RandomIt, typename Compare>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp, size_t threads) {
+    size_t n = static_cast<size_t>(std::distance(first, last));
+    // Not worth spawning threads for small inputs
+    threads = std::max<size_t>(1, std::min(threads, n / 65536));
+    if (threads <= 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t t = 0; t <= threads; ++t) bounds[t] = n * t / threads;
+    run_threads(threads, [&](size_t t) {
+        std::sort(first + bounds[t], first + bounds[t + 1], comp);
+    });
+
+    // Each round merges neighbouring runs, halving their number
+    while (bounds.size() > 2) {
+        size_t runs = bounds.size() - 1;
+        run_threads(runs / 2, [&](size_t t) {
+            std::inplace_merge(first + bounds[2 * t], first + bounds[2 * t + 1], first + bounds[2 * t + 2], comp);
+        });
+        std::vector<size_t> merged;
+        for (size_t i = 0; i < bounds.size(); i += 2) merged.push_back(bounds[i]);
+        if (merged.back() != bounds.back()) merged.push_back(bounds.back());
+        bounds.swap(merged);
+    }
+}
+
+} // namespace detail
+} // namespace MayDSA
+
+#endif // MAYDSA_PARALLEL_HPP
@@ -0,0 +1,185 @@
+#pragma once
+#ifndef MAYDSA_RADIX_HEAP_HPP
+#define MAYDSA_RADIX_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <iostream>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace MayDSA {
+
+/**
+ * @brief Monotone min-priority queue for integer keys (radix heap).
+ *
+ * Keys pushed must never be smaller than the last key popped (until the heap
+ * drains), which holds for Dijkstra-style searches with non-negative weights.
+ * An entry lives in bucket b = bit width of (key XOR last), so it only ever
+ * moves to a lower bucket: each entry is redistributed at most once per key
+ * bit, giving amortized O(log C) per operation with no comparisons on push.
+ */
+template<typename Key, typename Value>
+class RadixHeap {
+    static_assert(std::is_integral<Key>::value, "RadixHeap keys must be integers");
+
+private:
+    using Bits = std::make_unsigned_t<Key>;
+    using Entry = std::pair<Key, Value>;
+
+    static constexpr size_t key_bits = std::numeric_limits<Bits>::digits;
+
+    // Bucket 0 holds keys equal to last; bucket b holds keys whose highest
+    // differing bit from last is b - 1. Only pop() moves last, so last is
+    // always the last key popped.
+    std::vector<Entry> buckets[key_bits + 1];
+    Bits last;
+    size_t count;
+    // Position of the minimum found by top(); no_peek after any change
+    static constexpr size_t no_peek = static_cast<size_t>(-1);
+    mutable size_t peek_bucket;
+    mutable size_t peek_index;
+
+    // Order-preserving map to unsigned (flip the sign bit for signed keys)
+    static Bits to_bits(Key k) {
+        Bits b = static_cast<Bits>(k);
+        if (std::is_signed<Key>::value) b ^= Bits(1) << (key_bits - 1);
+        return b;
+    }
+
+    static size_t bit_width(Bits x) {
+#if defined(__GNUC__) || defined(__clang__)
+        if (x == 0) return 0;
+        if (sizeof(Bits) <= sizeof(unsigned)) return std::numeric_limits<unsigned>::digits - __builtin_clz(x);
+        return std::numeric_limits<unsigned long long>::digits - __builtin_clzll(x);
+#else
+        size_t w = 0;
+        while (x) {
+            x >>= 1;
+            ++w;
+        }
+        return w;
+#endif
+    }
+
+    size_t bucket_of(Bits b) const {
+        return bit_width(b ^ last);
+    }
+
+    void insert(Entry&& e) {
+        Bits b = to_bits(e.first);
+        if (b < last) throw std::invalid_argument("RadixHeap key is smaller than the last popped key");
+        buckets[bucket_of(b)].push_back(std::move(e));
+        ++count;
+        peek_bucket = no_peek;
+    }
+
+    // Refill bucket 0 from the lowest non-empty bucket; needs count > 0
+    void pull() {
+        if (!buckets[0].empty()) return;
+        size_t i = 1;
+        while (buckets[i].empty()) ++i;
+        std::vector<Entry>& src = buckets[i];
+        Bits new_last = to_bits(src[0].first);
+        for (const Entry& e : src) {
+            Bits b = to_bits(e.first);
+            if (b < new_last) new_last = b;
+        }
+        last = new_last;
+        // Everything in bucket i shares its bits above i - 1 with the new last,
+        // so each entry lands in a strictly lower bucket
+        for (Entry& e : src) buckets[bucket_of(to_bits(e.first))].push_back(std::move(e));
+        src.clear();
+    }
+
+    void remove_top() {
+        buckets[0].pop_back();
+        peek_bucket = no_peek;
+        // Once drained, any key is acceptable again
+        if (--count == 0) last = 0;
+    }
+
+public:
+    RadixHeap(): last(0), count(0), peek_bucket(no_peek), peek_index(0) {}
+
+    void push(Key key, const Value& val) {
+        insert(Entry(key, val));
+    }
+
+    void push(Key key, Value&& val) {
+        insert(Entry(key, std::move(val)));
+    }
+
+    template<typename... Args>
+    void emplace(Key key, Args&&... args) {
+        insert(Entry(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(std::forward<Args>(args)...)));
+    }
+
+    void pop() {
+        if (count == 0) throw std::out_of_range("Heap is empty");
+        pull();
+        remove_top();
+    }
+
+    // Remove the minimum entry and return it by move
+    Entry pop_value() {
+        if (count == 0) throw std::out_of_range("Heap is empty");
+        pull();
+        Entry result = std::move(buckets[0].back());
+        remove_top();
+        return result;
+    }
+
+    // Finds the minimum without redistributing, so pushes down to min_key()
+    // stay legal; O(1) in bucket 0, otherwise one scan of the lowest bucket
+    const Entry& top() const {
+        if (count == 0) throw std::out_of_range("Heap is empty");
+        if (peek_bucket == no_peek) {
+            size_t i = 0;
+            while (buckets[i].empty()) ++i;
+            const std::vector<Entry>& src = buckets[i];
+            size_t best = src.size() - 1;
+            for (size_t j = 0; j < src.size(); ++j)
+                if (to_bits(src[j].first) < to_bits(src[best].first)) best = j;
+            peek_bucket = i;
+            peek_index = best;
+        }
+        return buckets[peek_bucket][peek_index];
+    }
+
+    // Smallest key that may currently be pushed
+    Key min_key() const {
+        Bits b = last;
+        if (std::is_signed<Key>::value) b ^= Bits(1) << (key_bits - 1);
+        return static_cast<Key>(b);
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    void clear() {
+        for (auto& b : buckets) b.clear();
+        last = 0;
+        count = 0;
+        peek_bucket = no_peek;
+    }
+
+    void print() const {
+        std::cout << "[ ";
+        for (const auto& b : buckets)
+            for (const auto& e : b) std::cout << e.first << ":" << e.second << " ";
+        std::cout << "]\n";
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_RADIX_HEAP_HPP
@@ -0,0 +1,408 @@
+#pragma once
+#ifndef MAYDSA_SIMD_HPP
+#define MAYDSA_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Vectorized scan kernels (find/count/min/max/sum) over contiguous arrays.
+ *
+ * On x86 with GCC/Clang, SSE2 kernels are used by default and AVX2 kernels are
+ * selected at runtime when the CPU supports them. Everything else falls back
+ * to plain scalar loops. Accelerated types: 32-bit integers, float, double,
+ * and (AVX2 only) 64-bit integers for equality scans.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define MAYDSA_SIMD_X86 1
+#include <immintrin.h>
+#define MAYDSA_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MAYDSA_SIMD_X86 0
+#endif
+
+namespace MayDSA {
+namespace simd {
+
+// Accumulator used by sum(): 64-bit for integers, double for floating point
+template<typename T>
+using sum_type = std::conditional_t<std::is_floating_point<T>::value, double,
+                 std::conditional_t<std::is_signed<T>::value, long long, unsigned long long>>;
+
+namespace detail {
+
+// ---------- Scalar fallbacks ----------
+
+template<typename T>
+size_t find_scalar(const T* p, size_t n, const T& value) {
+    for (size_t i = 0; i < n; ++i)
+        if (p[i] == value) return i;
+    return static_cast<size_t>(-1);
+}
+
+template<typename T>
+size_t count_scalar(const T* p, size_t n, const T& value) {
+    size_t c = 0;
+    for (size_t i = 0; i < n; ++i)
+        if (p[i] == value) ++c;
+    return c;
+}
+
+template<typename T>
+T min_scalar(const T* p, size_t n) {
+    T best = p[0];
+    for (size_t i = 1; i < n; ++i)
+        if (p[i] < best) best = p[i];
+    return best;
+}
+
+template<typename T>
+T max_scalar(const T* p, size_t n) {
+    T best = p[0];
+    for (size_t i = 1; i < n; ++i)
+        if (best < p[i]) best = p[i];
+    return best;
+}
+
+template<typename T>
+sum_type<T> sum_scalar(const T* p, size_t n) {
+    sum_type<T> s = 0;
+    for (size_t i = 0; i < n; ++i) s += p[i];
+    return s;
+}
+
+#if MAYDSA_SIMD_X86
+
+inline bool cpu_has_avx2() {
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+
+inline int lowest_bit(unsigned mask) { return __builtin_ctz(mask); }
+inline int popcount(unsigned mask) { return __builtin_popcount(mask); }
+
+// Each ISA/type pair exposes the same small vocabulary so the scan loops
+// below are written once. eq_mask() yields one bit per lane.
+
+struct Sse2I32 {
+    using T = int32_t;
+    using V = __m128i;
+    static constexpr size_t lanes = 4;
+    static V load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static V set1(T x) { return _mm_set1_epi32(x); }
+    static unsigned eq_mask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static V vmin(V a, V b) { V gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a)); }
+    static V vmax(V a, V b) { V gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b)); }
+    static void store(T* out, V a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a); }
+};
+
+struct Sse2F32 {
+    using T = float;
+    using V = __m128;
+    static constexpr size_t lanes = 4;
+    static V load(const T* p) { return _mm_loadu_ps(p); }
+    static V set1(T x) { return _mm_set1_ps(x); }
+    static unsigned eq_mask(V a, V b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static V vmin(V a, V b) { return _mm_min_ps(a, b); }
+    static V vmax(V a, V b) { return _mm_max_ps(a, b); }
+    static void store(T* out, V a) { _mm_storeu_ps(out, a); }
+};
+
+struct Sse2F64 {
+    using T = double;
+    using V = __m128d;
+    static constexpr size_t lanes = 2;
+    static V load(const T* p) { return _mm_loadu_pd(p); }
+    static V set1(T x) { return _mm_set1_pd(x); }
+    static unsigned eq_mask(V a, V b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static V vmin(V a, V b) { return _mm_min_pd(a, b); }
+    static V vmax(V a, V b) { return _mm_max_pd(a, b); }
+    static void store(T* out, V a) { _mm_storeu_pd(out, a); }
+};
+
+struct Avx2I32 {
+    using T = int32_t;
+    using V = __m256i;
+    static constexpr size_t lanes = 8;
+    MAYDSA_TARGET_AVX2 static V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    MAYDSA_TARGET_AVX2 static V set1(T x) { return _mm256_set1_epi32(x); }
+    MAYDSA_TARGET_AVX2 static unsigned eq_mask(V a, V b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+    MAYDSA_TARGET_AVX2 static V vmin(V a, V b) { return _mm256_min_epi32(a, b); }
+    MAYDSA_TARGET_AVX2 static V vmax(V a, V b) { return _mm256_max_epi32(a, b); }
+    MAYDSA_TARGET_AVX2 static void store(T* out, V a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a); }
+};
+
+struct Avx2I64 {
+    using T = int64_t;
+    using V = __m256i;
+    static constexpr size_t lanes = 4;
+    MAYDSA_TARGET_AVX2 static V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    MAYDSA_TARGET_AVX2 static V set1(T x) { return _mm256_set1_epi64x(x); }
+    MAYDSA_TARGET_AVX2 static unsigned eq_mask(V a, V b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+};
+
+struct Avx2F32 {
+    using T = float;
+    using V = __m256;
+    static constexpr size_t lanes = 8;
+    MAYDSA_TARGET_AVX2 static V load(const T* p) { return _mm256_loadu_ps(p); }
+    MAYDSA_TARGET_AVX2 static V set1(T x) { return _mm256_set1_ps(x); }
+    MAYDSA_TARGET_AVX2 static unsigned eq_mask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    MAYDSA_TARGET_AVX2 static V vmin(V a, V b) { return _mm256_min_ps(a, b); }
+    MAYDSA_TARGET_AVX2 static V vmax(V a, V b) { return _mm256_max_ps(a, b); }
+    MAYDSA_TARGET_AVX2 static void store(T* out, V a) { _mm256_storeu_ps(out, a); }
+};
+
+struct Avx2F64 {
+    using T = double;
+    using V = __m256d;
+    static constexpr size_t lanes = 4;
+    MAYDSA_TARGET_AVX2 static V load(const T* p) { return _mm256_loadu_pd(p); }
+    MAYDSA_TARGET_AVX2 static V set1(T x) { return _mm256_set1_pd(x); }
+    MAYDSA_TARGET_AVX2 static unsigned eq_mask(V a, V b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    MAYDSA_TARGET_AVX2 static V vmin(V a, V b) { return _mm256_min_pd(a, b); }
+    MAYDSA_TARGET_AVX2 static V vmax(V a, V b) { return _mm256_max_pd(a, b); }
+    MAYDSA_TARGET_AVX2 static void store(T* out, V a) { _mm256_storeu_pd(out, a); }
+};
+
+// Scan loops: instantiated once per ISA; the AVX2 variants carry the target attribute.
+#define MAYDSA_SIMD_SCAN_KERNELS(ATTR, SUFFIX)                                      \
+template<typename Ops>                                                              \
+ATTR size_t find_##SUFFIX(const typename Ops::T* p, size_t n, typename Ops::T x) {  \
+    const auto needle = Ops::set1(x);                                               \
+    size_t i = 0;                                                                   \
+    for (; i + Ops::lanes <= n; i += Ops::lanes) {                                  \
+        unsigned m = Ops::eq_mask(Ops::load(p + i), needle);                        \
+        if (m) return i + lowest_bit(m);                                            \
+    }                                                                               \
+    for (; i < n; ++i)                                                              \
+        if (p[i] == x) return i;                                                    \
+    return static_cast<size_t>(-1);                                                 \
+}                                                                                   \
+template<typename Ops>                                                              \
+ATTR size_t count_##SUFFIX(const typename Ops::T* p, size_t n, typename Ops::T x) { \
+    const auto needle = Ops::set1(x);                                               \
+    size_t c = 0, i = 0;                                                            \
+    for (; i + Ops::lanes <= n; i += Ops::lanes)                                    \
+        c += popcount(Ops::eq_mask(Ops::load(p + i), needle));                      \
+    for (; i < n; ++i)                                                              \
+        if (p[i] == x) ++c;                                                         \
+    return c;                                                                       \
+}                                                                                   \
+template<typename Ops, bool IsMin>                                                  \
+ATTR typename Ops::T minmax_##SUFFIX(const typename Ops::T* p, size_t n) {          \
+    using T = typename Ops::T;                                                      \
+    if (n < Ops::lanes) return IsMin ? min_scalar(p, n) : max_scalar(p, n);         \
+    auto acc = Ops::load(p);                                                        \
+    size_t i = Ops::lanes;                                                          \
+    for (; i + Ops::lanes <= n; i += Ops::lanes)                                    \
+        acc = IsMin ? Ops::vmin(acc, Ops::load(p + i)) : Ops::vmax(acc, Ops::load(p + i)); \
+    T part[Ops::lanes];                                                             \
+    Ops::store(part, acc);                                                          \
+    T best = IsMin ? min_scalar(part, Ops::lanes) : max_scalar(part, Ops::lanes);   \
+    for (; i < n; ++i)                                                              \
+        if (IsMin ? (p[i] < best) : (best < p[i])) best = p[i];                     \
+    return best;                                                                    \
+}
+
+MAYDSA_SIMD_SCAN_KERNELS(, sse2)
+MAYDSA_SIMD_SCAN_KERNELS(MAYDSA_TARGET_AVX2, avx2)
+#undef MAYDSA_SIMD_SCAN_KERNELS
+
+// Sums widen to 64-bit / double lanes so results match the scalar accumulator type.
+
+inline long long sum_i32_sse2(const int32_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i sign = _mm_cmpgt_epi32(zero, x);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+    }
+    alignas(16) long long part[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(part), acc);
+    long long s = part[0] + part[1];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+MAYDSA_TARGET_AVX2 inline long long sum_i32_avx2(const int32_t* p, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+    }
+    alignas(32) long long part[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(part), acc);
+    long long s = part[0] + part[1] + part[2] + part[3];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+inline double sum_f32_sse2(const float* p, size_t n) {
+    __m128d acc = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(p + i);
+        acc = _mm_add_pd(acc, _mm_cvtps_pd(x));
+        acc = _mm_add_pd(acc, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    }
+    alignas(16) double part[2];
+    _mm_store_pd(part, acc);
+    double s = part[0] + part[1];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+MAYDSA_TARGET_AVX2 inline double sum_f32_avx2(const float* p, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(p + i);
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(x)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)));
+    }
+    alignas(32) double part[4];
+    _mm256_store_pd(part, acc);
+    double s = part[0] + part[1] + part[2] + part[3];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+inline double sum_f64_sse2(const double* p, size_t n) {
+    __m128d acc = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) acc = _mm_add_pd(acc, _mm_loadu_pd(p + i));
+    alignas(16) double part[2];
+    _mm_store_pd(part, acc);
+    double s = part[0] + part[1];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+MAYDSA_TARGET_AVX2 inline double sum_f64_avx2(const double* p, size_t n) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) acc = _mm256_add_pd(acc, _mm256_loadu_pd(p + i));
+    alignas(32) double part[4];
+    _mm256_store_pd(part, acc);
+    double s = part[0] + part[1] + part[2] + part[3];
+    for (; i < n; ++i) s += p[i];
+    return s;
+}
+
+// Maps an element type onto the kernel family that handles it (if any)
+template<typename T>
+struct kind {
+    static constexpr bool i32 = std::is_integral<T>::value && sizeof(T) == 4;
+    static constexpr bool i64 = std::is_integral<T>::value && sizeof(T) == 8;
+    static constexpr bool f32 = std::is_same<T, float>::value;
+    static constexpr bool f64 = std::is_same<T, double>::value;
+    // min/max and sum on 32-bit ints are only valid for the signed kernels
+    static constexpr bool signed_i32 = i32 && std::is_signed<T>::value;
+};
+
+#endif // MAYDSA_SIMD_X86
+
+} // namespace detail
+
+// Index of the first element equal to value, or size_t(-1)
+template<typename T>
+size_t find(const T* p, size_t n, const T& value) {
+#if MAYDSA_SIMD_X86
+    using K = detail::kind<T>;
+    if constexpr (K::i32) {
+        const int32_t* q = reinterpret_cast<const int32_t*>(p);
+        int32_t x = static_cast<int32_t>(value);
+        return detail::cpu_has_avx2() ? detail::find_avx2<detail::Avx2I32>(q, n, x)
+                                      : detail::find_sse2<detail::Sse2I32>(q, n, x);
+    } else if constexpr (K::i64) {
+        if (detail::cpu_has_avx2())
+            return detail::find_avx2<detail::Avx2I64>(reinterpret_cast<const int64_t*>(p), n, static_cast<int64_t>(value));
+    } else if constexpr (K::f32) {
+        return detail::cpu_has_avx2() ? detail::find_avx2<detail::Avx2F32>(p, n, value)
+                                      : detail::find_sse2<detail::Sse2F32>(p, n, value);
+    } else if constexpr (K::f64) {
+        return detail::cpu_has_avx2() ? detail::find_avx2<detail::Avx2F64>(p, n, value)
+                                      : detail::find_sse2<detail::Sse2F64>(p, n, value);
+    }
+#endif
+    return detail::find_scalar(p, n, value);
+}
+
+// Number of elements equal to value
+template<typename T>
+size_t count(const T* p, size_t n, const T& value) {
+#if MAYDSA_SIMD_X86
+    using K = detail::kind<T>;
+    if constexpr (K::i32) {
+        const int32_t* q = reinterpret_cast<const int32_t*>(p);
+        int32_t x = static_cast<int32_t>(value);
+        return detail::cpu_has_avx2() ? detail::count_avx2<detail::Avx2I32>(q, n, x)
+                                      : detail::count_sse2<detail::Sse2I32>(q, n, x);
+    } else if constexpr (K::i64) {
+        if (detail::cpu_has_avx2())
+            return detail::count_avx2<detail::Avx2I64>(reinterpret_cast<const int64_t*>(p), n, static_cast<int64_t>(value));
+    } else if constexpr (K::f32) {
+        return detail::cpu_has_avx2() ? detail::count_avx2<detail::Avx2F32>(p, n, value)
+                                      : detail::count_sse2<detail::Sse2F32>(p, n, value);
+    } else if constexpr (K::f64) {
+        return detail::cpu_has_avx2() ? detail::count_avx2<detail::Avx2F64>(p, n, value)
+                                      : detail::count_sse2<detail::Sse2F64>(p, n, value);
+    }
+#endif
+    return detail::count_scalar(p, n, value);
+}
+
+// Smallest / largest element; n must be > 0. NaN ordering is unspecified.
+template<typename T, bool IsMin>
+T minmax(const T* p, size_t n) {
+#if MAYDSA_SIMD_X86
+    using K = detail::kind<T>;
+    if constexpr (K::signed_i32) {
+        const int32_t* q = reinterpret_cast<const int32_t*>(p);
+        return static_cast<T>(detail::cpu_has_avx2() ? detail::minmax_avx2<detail::Avx2I32, IsMin>(q, n)
+                                                     : detail::minmax_sse2<detail::Sse2I32, IsMin>(q, n));
+    } else if constexpr (K::f32) {
+        return detail::cpu_has_avx2() ? detail::minmax_avx2<detail::Avx2F32, IsMin>(p, n)
+                                      : detail::minmax_sse2<detail::Sse2F32, IsMin>(p, n);
+    } else if constexpr (K::f64) {
+        return detail::cpu_has_avx2() ? detail::minmax_avx2<detail::Avx2F64, IsMin>(p, n)
+                                      : detail::minmax_sse2<detail::Sse2F64, IsMin>(p, n);
+    }
+#endif
+    return IsMin ? detail::min_scalar(p, n) : detail::max_scalar(p, n);
+}
+
+template<typename T>
+T min(const T* p, size_t n) { return minmax<T, true>(p, n); }
+
+template<typename T>
+T max(const T* p, size_t n) { return minmax<T, false>(p, n); }
+
+// Sum of all elements in a widened accumulator (see sum_type)
+template<typename T>
+sum_type<T> sum(const T* p, size_t n) {
+#if MAYDSA_SIMD_X86
+    using K = detail::kind<T>;
+    if constexpr (K::signed_i32) {
+        const int32_t* q = reinterpret_cast<const int32_t*>(p);
+        return detail::cpu_has_avx2() ? detail::sum_i32_avx2(q, n) : detail::sum_i32_sse2(q, n);
+    } else if constexpr (K::f32) {
+        return detail::cpu_has_avx2() ? detail::sum_f32_avx2(p, n) : detail::sum_f32_sse2(p, n);
+    } else if constexpr (K::f64) {
+        return detail::cpu_has_avx2() ? detail::sum_f64_avx2(p, n) : detail::sum_f64_sse2(p, n);
+    }
+#endif
+    return detail::sum_scalar(p, n);
+}
+
+} // namespace simd
+} // namespace MayDSA
+
+#endif // MAYDSA_SIMD_HPP
@@ -0,0 +1,437 @@
+#ifndef MAYDSA_SKIP_LIST_HPP
+#define MAYDSA_SKIP_LIST_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <functional>
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+namespace MayDSA{
+
+/**
+ * @brief Indexable skip list: LinkedList's interface with O(log n) positions.
+ *
+ * Each forward link stores its span (how many elements it skips), so
+ * insert(pos), remove(pos) and at(pos) run in expected O(log n) instead of
+ * scanning from head.
+ *
+ * Constructed with isOrdered = true it becomes an ordered set instead:
+ * insert(val) places the value by Compare and rejects duplicates, and
+ * find/contains/erase take O(log n). Positional insertion and reverse()
+ * would break the ordering, so they throw std::logic_error in that mode.
+ */
+template<typename T, typename Compare = std::less<T>>
+class SkipList {
+private:
+    static constexpr int max_level = 32;
+
+    struct Node;
+    struct Link {
+        Node* next;
+        size_t span;  // Elements advanced by following next (valid only when next != nullptr)
+    };
+
+    struct alignas(Link) alignas(T) Node {
+        T data;
+        int level;
+        template<typename U>
+        Node(U&& val, int lvl): data(std::forward<U>(val)), level(lvl) {}
+        Link* links() { return reinterpret_cast<Link*>(this + 1); }
+    };
+
+    Link head[max_level];  // Links out of the head sentinel
+    int level;             // Levels currently in use
+    size_t length;
+    bool ordered;
+    Compare comp;
+    uint64_t rng;
+
+    int random_level();
+    template<typename U> Node* create_node(U&& val, int lvl);
+    void destroy_node(Node* node);
+
+    // Predecessor links at every level for inserting before / removing position pos
+    void find_position(size_t pos, Link** update, size_t* rank);
+    // Same, but locating the first element not less than val
+    void find_value(const T& val, Link** update, size_t* rank);
+    template<typename U> void insert_at(Link** update, size_t* rank, size_t pos, U&& val);
+    void erase_at(Link** update);
+    void relink(const std::vector<Node*>& order);
+    Node* node_at(size_t pos) const;
+
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // Constructor and destructor
+    SkipList(bool isOrdered = false);
+    SkipList(const SkipList& other);
+    SkipList& operator=(const SkipList& other);
+    ~SkipList();
+
+    // Core operations (sequence mode)
+    void push_front(const T& val);
+    void push_back(const T& val);
+    void insert(size_t pos, const T& val);
+    void reverse();
+
+    // Core operations (both modes)
+    void pop_front();
+    void pop_back();
+    void remove(size_t pos);
+    void clear();
+
+    // Ordered-set mode
+    bool insert(const T& val);
+    bool erase(const T& val);
+    bool contains(const T& val) const;
+
+    // Utility
+    T& at(size_t pos);
+    const T& at(size_t pos) const;
+    size_t size() const;
+    bool empty() const;
+    bool is_ordered() const;
+    // Index of val, or npos: O(log n) when ordered, linear scan otherwise
+    size_t find(const T& val) const;
+    void print() const;
+};
+
+template<typename T, typename C>
+int MayDSA::SkipList<T, C>::random_level() {
+    // xorshift64; each extra level with probability 1/4
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    uint64_t bits = rng;
+    int lvl = 1;
+    while (lvl < max_level && (bits & 3) == 0) {
+        ++lvl;
+        bits >>= 2;
+    }
+    return lvl;
+}
+
+template<typename T, typename C>
+template<typename U>
+typename MayDSA::SkipList<T, C>::Node* MayDSA::SkipList<T, C>::create_node(U&& val, int lvl) {
+    void* p = ::operator new(sizeof(Node) + lvl * sizeof(Link));
+    try {
+        return ::new (p) Node(std::forward<U>(val), lvl);
+    } catch (...) {
+        ::operator delete(p);
+        throw;
+    }
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::destroy_node(Node* node) {
+    node->~Node();
+    ::operator delete(static_cast<void*>(node));
+}
+
+template<typename T, typename C>
+MayDSA::SkipList<T, C>::SkipList(bool isOrdered)
+    : level(1), length(0), ordered(isOrdered), rng(0x9E3779B97F4A7C15ull) {
+    for (Link& l : head) l = {nullptr, 0};
+}
+
+template<typename T, typename C>
+MayDSA::SkipList<T, C>::SkipList(const SkipList& other) : SkipList(other.ordered) {
+    comp = other.comp;
+    // Append in order; both modes keep other's order, so sequence insertion is safe
+    Link* update[max_level];
+    size_t rank[max_level];
+    for (const Link* l = other.head; l[0].next; l = l[0].next->links()) {
+        find_position(length, update, rank);
+        insert_at(update, rank, length, l[0].next->data);
+    }
+}
+
+template<typename T, typename C>
+MayDSA::SkipList<T, C>& MayDSA::SkipList<T, C>::operator=(const SkipList& other) {
+    if (this != &other) {
+        SkipList tmp(other);
+        clear();
+        std::swap(head, tmp.head);
+        std::swap(level, tmp.level);
+        std::swap(length, tmp.length);
+        std::swap(ordered, tmp.ordered);
+        std::swap(comp, tmp.comp);
+    }
+    return *this;
+}
+
+template<typename T, typename C>
+MayDSA::SkipList<T, C>::~SkipList() {
+    clear();
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::clear() {
+    Node* curr = head[0].next;
+    while (curr) {
+        Node* next = curr->links()[0].next;
+        destroy_node(curr);
+        curr = next;
+    }
+    for (Link& l : head) l = {nullptr, 0};
+    level = 1;
+    length = 0;
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::find_position(size_t pos, Link** update, size_t* rank) {
+    Link* x = head;
+    size_t r = 0;
+    for (int i = level - 1; i >= 0; --i) {
+        while (x[i].next && r + x[i].span <= pos) {
+            r += x[i].span;
+            x = x[i].next->links();
+        }
+        update[i] = x;
+        rank[i] = r;
+    }
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::find_value(const T& val, Link** update, size_t* rank) {
+    Link* x = head;
+    size_t r = 0;
+    for (int i = level - 1; i >= 0; --i) {
+        while (x[i].next && comp(x[i].next->data, val)) {
+            r += x[i].span;
+            x = x[i].next->links();
+        }
+        update[i] = x;
+        rank[i] = r;
+    }
+}
+
+template<typename T, typename C>
+template<typename U>
+void MayDSA::SkipList<T, C>::insert_at(Link** update, size_t* rank, size_t pos, U&& val) {
+    int lvl = random_level();
+    if (lvl > level) {
+        for (int i = level; i < lvl; ++i) {
+            update[i] = head;
+            rank[i] = 0;
+            head[i] = {nullptr, 0};
+        }
+        level = lvl;
+    }
+    Node* n = create_node(std::forward<U>(val), lvl);
+    Link* nl = n->links();
+    for (int i = 0; i < lvl; ++i) {
+        Link& prev = update[i][i];
+        size_t before = pos - rank[i];  // elements between update[i] and the new node
+        nl[i].next = prev.next;
+        nl[i].span = prev.next ? prev.span - before : 0;
+        prev.next = n;
+        prev.span = before + 1;
+    }
+    for (int i = lvl; i < level; ++i) {
+        if (update[i][i].next) update[i][i].span++;
+    }
+    ++length;
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::erase_at(Link** update) {
+    Node* x = update[0][0].next;
+    Link* xl = x->links();
+    for (int i = 0; i < level; ++i) {
+        Link& prev = update[i][i];
+        if (prev.next == x) {
+            prev.next = xl[i].next;
+            prev.span = xl[i].next ? prev.span + xl[i].span - 1 : 0;
+        } else if (prev.next) {
+            prev.span--;
+        }
+    }
+    while (level > 1 && head[level - 1].next == nullptr) --level;
+    destroy_node(x);
+    --length;
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::relink(const std::vector<Node*>& order) {
+    // Rebuild every level's links for the given element order; levels stay with their nodes
+    Link* last[max_level];
+    size_t last_rank[max_level];
+    for (int i = 0; i < max_level; ++i) {
+        head[i] = {nullptr, 0};
+        last[i] = head;
+        last_rank[i] = 0;
+    }
+    for (size_t r = 1; r <= order.size(); ++r) {
+        Node* n = order[r - 1];
+        Link* nl = n->links();
+        for (int i = 0; i < n->level; ++i) {
+            last[i][i] = {n, r - last_rank[i]};
+            last[i] = nl;
+            last_rank[i] = r;
+            nl[i] = {nullptr, 0};
+        }
+    }
+}
+
+template<typename T, typename C>
+typename MayDSA::SkipList<T, C>::Node* MayDSA::SkipList<T, C>::node_at(size_t pos) const {
+    const Link* x = head;
+    size_t r = 0, target = pos + 1;
+    for (int i = level - 1; i >= 0; --i) {
+        while (x[i].next && r + x[i].span <= target) {
+            r += x[i].span;
+            if (r == target) return x[i].next;
+            x = x[i].next->links();
+        }
+    }
+    return nullptr;
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::insert(size_t pos, const T& val) {
+    if (ordered) throw std::logic_error("Positional insert is not allowed on an ordered SkipList");
+    if (pos > length) throw std::out_of_range("Index out of range");
+    Link* update[max_level];
+    size_t rank[max_level];
+    find_position(pos, update, rank);
+    insert_at(update, rank, pos, val);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::push_front(const T& val) {
+    insert(0, val);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::push_back(const T& val) {
+    insert(length, val);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::remove(size_t pos) {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    Link* update[max_level];
+    size_t rank[max_level];
+    find_position(pos, update, rank);
+    erase_at(update);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::pop_front() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    remove(0);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::pop_back() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    remove(length - 1);
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::reverse() {
+    if (ordered) throw std::logic_error("Cannot reverse an ordered SkipList");
+    std::vector<Node*> order;
+    order.reserve(length);
+    for (Node* n = head[0].next; n; n = n->links()[0].next) order.push_back(n);
+    std::reverse(order.begin(), order.end());
+    relink(order);
+}
+
+template<typename T, typename C>
+bool MayDSA::SkipList<T, C>::insert(const T& val) {
+    if (!ordered) throw std::logic_error("Value insert needs an ordered SkipList; use insert(pos, val)");
+    Link* update[max_level];
+    size_t rank[max_level];
+    find_value(val, update, rank);
+    Node* cand = update[0][0].next;
+    if (cand && !comp(val, cand->data)) return false;  // already present
+    insert_at(update, rank, rank[0], val);
+    return true;
+}
+
+template<typename T, typename C>
+bool MayDSA::SkipList<T, C>::erase(const T& val) {
+    if (!ordered) {
+        size_t idx = find(val);
+        if (idx == npos) return false;
+        remove(idx);
+        return true;
+    }
+    Link* update[max_level];
+    size_t rank[max_level];
+    find_value(val, update, rank);
+    Node* cand = update[0][0].next;
+    if (!cand || comp(val, cand->data)) return false;
+    erase_at(update);
+    return true;
+}
+
+template<typename T, typename C>
+bool MayDSA::SkipList<T, C>::contains(const T& val) const {
+    return find(val) != npos;
+}
+
+template<typename T, typename C>
+size_t MayDSA::SkipList<T, C>::find(const T& val) const {
+    if (!ordered) {
+        size_t idx = 0;
+        for (Node* n = head[0].next; n; n = n->links()[0].next, ++idx)
+            if (n->data == val) return idx;
+        return npos; // not found
+    }
+    const Link* x = head;
+    size_t r = 0;
+    for (int i = level - 1; i >= 0; --i) {
+        while (x[i].next && comp(x[i].next->data, val)) {
+            r += x[i].span;
+            x = x[i].next->links();
+        }
+    }
+    Node* cand = x[0].next;
+    return (cand && !comp(val, cand->data)) ? r : npos;
+}
+
+template<typename T, typename C>
+T& MayDSA::SkipList<T, C>::at(size_t pos) {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    return node_at(pos)->data;
+}
+
+template<typename T, typename C>
+const T& MayDSA::SkipList<T, C>::at(size_t pos) const {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    return node_at(pos)->data;
+}
+
+template<typename T, typename C>
+size_t MayDSA::SkipList<T, C>::size() const {
+    return length;
+}
+
+template<typename T, typename C>
+bool MayDSA::SkipList<T, C>::empty() const {
+    return length == 0;
+}
+
+template<typename T, typename C>
+bool MayDSA::SkipList<T, C>::is_ordered() const {
+    return ordered;
+}
+
+template<typename T, typename C>
+void MayDSA::SkipList<T, C>::print() const {
+    std::cout << "[ ";
+    for (Node* n = head[0].next; n; n = n->links()[0].next) std::cout << n->data << " ";
+    std::cout << "]\n";
+}
+
+} // namespace MayDSA
+
+#endif
@@ -0,0 +1,341 @@
+#pragma once
+#ifndef MAYDSA_SMALL_VECTOR_HPP
+#define MAYDSA_SMALL_VECTOR_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <new>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include "vector.hpp"
+
+/**
+ * @brief Vector with inline storage for the first N elements.
+ *
+ * Same interface as MayDSA::Vector, but holds up to N elements without touching
+ * the heap; only growing past N allocates. Moving an inline SmallVector moves
+ * its elements one by one, so it is O(size) rather than a pointer steal.
+ *
+ * @tparam T Type of the elements stored in the SmallVector.
+ * @tparam N Number of elements stored inline.
+ */
+namespace MayDSA {
+
+template<typename T, size_t N = 8>
+class SmallVector {
+    static_assert(N > 0, "SmallVector needs at least one inline slot");
+
+private:
+    T* buffer;        // Points at inline_buf or at a heap block
+    size_t length;    // Number of elements stored
+    size_t capacity;  // N while inline
+    alignas(T) unsigned char inline_buf[N * sizeof(T)];
+
+    T* inline_data() { return reinterpret_cast<T*>(inline_buf); }
+    const T* inline_data() const { return reinterpret_cast<const T*>(inline_buf); }
+
+    bool is_inline() const { return buffer == inline_data(); }
+
+    static void destroy(T* first, T* last) {
+        detail::destroy_range(first, last);
+    }
+
+    // Move storage to a fresh heap block (or back inline if it fits)
+    void reallocate(size_t new_capacity) {
+        if (new_capacity <= N) {
+            if (is_inline()) return;
+            new_capacity = N;
+        }
+        T* new_data = new_capacity == N ? inline_data()
+                                        : static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        try {
+            detail::relocate_range(buffer, length, new_data);
+        } catch (...) {
+            if (new_data != inline_data()) ::operator delete(static_cast<void*>(new_data));
+            throw;
+        }
+        if (!is_inline()) ::operator delete(static_cast<void*>(buffer));
+        buffer = new_data;
+        capacity = new_capacity;
+    }
+
+    void resize() {
+        reallocate(capacity * 2);
+    }
+
+    void steal(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other.is_inline()) {
+            for (size_t i = 0; i < other.length; ++i)
+                ::new (static_cast<void*>(buffer + i)) T(std::move(other.buffer[i]));
+            length = other.length;
+            other.clear();
+        } else {
+            buffer = other.buffer;
+            length = other.length;
+            capacity = other.capacity;
+            other.buffer = other.inline_data();
+            other.length = 0;
+            other.capacity = N;
+        }
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr size_t inline_capacity = N;
+
+    // Constructor
+    SmallVector() : buffer(inline_data()), length(0), capacity(N) {}
+
+    // Destructor
+    ~SmallVector() {
+        destroy(buffer, buffer + length);
+        if (!is_inline()) ::operator delete(static_cast<void*>(buffer));
+    }
+
+    // Copy constructor
+    SmallVector(const SmallVector& other) : SmallVector() {
+        reserve(other.length);
+        std::uninitialized_copy(other.buffer, other.buffer + other.length, buffer);
+        length = other.length;
+    }
+
+    // Move constructor
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector() {
+        steal(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            insert_range(0, other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            if (!is_inline()) {
+                ::operator delete(static_cast<void*>(buffer));
+                buffer = inline_data();
+                capacity = N;
+            }
+            steal(other);
+        }
+        return *this;
+    }
+
+    // Access operator (unchecked)
+    T& operator[](size_t index) { return buffer[index]; }
+    const T& operator[](size_t index) const { return buffer[index]; }
+
+    // Bounds-checked access
+    T& at(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of bounds");
+        return buffer[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of bounds");
+        return buffer[index];
+    }
+
+    T* data() { return buffer; }
+    const T* data() const { return buffer; }
+
+    T* begin() { return buffer; }
+    T* end() { return buffer + length; }
+    const T* begin() const { return buffer; }
+    const T* end() const { return buffer + length; }
+    const T* cbegin() const { return buffer; }
+    const T* cend() const { return buffer + length; }
+
+    Span<T> span() { return Span<T>(buffer, length); }
+    Span<const T> span() const { return Span<const T>(buffer, length); }
+
+    Span<T> slice(size_t first, size_t count) {
+        return span().subspan(first, count);
+    }
+
+    Span<const T> slice(size_t first, size_t count) const {
+        return span().subspan(first, count);
+    }
+
+    // Add element to end
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Construct element in place at the end
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (length == capacity) {
+            // args may alias an element that is about to be relocated
+            T tmp(std::forward<Args>(args)...);
+            resize();
+            ::new (static_cast<void*>(buffer + length)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(buffer + length)) T(std::forward<Args>(args)...);
+        }
+        return buffer[length++];
+    }
+
+    // Remove last element
+    void pop_back() {
+        if (length == 0) throw std::underflow_error("Vector is empty");
+        length--;
+        buffer[length].~T();
+    }
+
+    // Insert at position
+    void insert(size_t index, const T& value) {
+        T tmp(value);
+        insert_range(index, std::make_move_iterator(&tmp), std::make_move_iterator(&tmp + 1));
+    }
+
+    // Remove at position
+    void remove(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of bounds");
+        erase_range(index, index + 1);
+    }
+
+    // Insert [first, last) before index with at most one reallocation
+    template<typename InputIt>
+    void insert_range(size_t index, InputIt first, InputIt last) {
+        if (index > length) throw std::out_of_range("Index out of bounds");
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        bool copy_out = !std::is_base_of<std::forward_iterator_tag, category>::value ||
+                        detail::points_into(first, buffer, length);
+        if (copy_out) {
+            // Single-pass source, or one aliasing our own storage
+            Vector<T> tmp;
+            for (; first != last; ++first) tmp.emplace_back(*first);
+            insert_range(index, std::make_move_iterator(tmp.begin()), std::make_move_iterator(tmp.end()));
+            return;
+        }
+
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            size_t k = static_cast<size_t>(std::distance(first, last));
+            if (k == 0) return;
+            if (length + k > capacity) reallocate(std::max(capacity * 2, length + k));
+            detail::insert_shift(buffer, length, index, k, first, last);
+            length += k;
+        }
+    }
+
+    // Remove elements in [first, last) with a single compaction pass
+    void erase_range(size_t first, size_t last) {
+        if (first > last || last > length) throw std::out_of_range("Index out of bounds");
+        size_t k = last - first;
+        if (k == 0) return;
+        detail::erase_shift(buffer, length, first, last);
+        length -= k;
+    }
+
+    // Remove every element matching pred in one pass; returns how many were removed
+    template<typename Pred>
+    size_t erase_if(Pred pred) {
+        size_t w = detail::compact_if(buffer, length, pred);
+        size_t removed = length - w;
+        length = w;
+        return removed;
+    }
+
+    // Make room for at least n elements without changing size
+    void reserve(size_t n) {
+        if (n > capacity) reallocate(n);
+    }
+
+    // Release unused heap capacity, moving back inline when the elements fit
+    void shrink_to_fit() {
+        if (!is_inline() && length < capacity) reallocate(length);
+    }
+
+    // Reverse the array
+    void reverse() {
+        for (size_t i = 0; i < length / 2; ++i)
+            std::swap(buffer[i], buffer[length - 1 - i]);
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    bool empty() const {
+        return length == 0;
+    }
+
+    size_t get_capacity() const {
+        return capacity;
+    }
+
+    // True while no heap block is in use
+    bool is_small() const {
+        return is_inline();
+    }
+
+    // Clear all elements (keeps any heap block)
+    void clear() {
+        destroy(buffer, buffer + length);
+        length = 0;
+    }
+
+    // Find first index of value, or npos
+    size_t find(const T& value) const {
+        return simd::find(buffer, length, value);
+    }
+
+    size_t count(const T& value) const {
+        return simd::count(buffer, length, value);
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != npos;
+    }
+
+    T min() const {
+        if (length == 0) throw std::underflow_error("Vector is empty");
+        return simd::min(buffer, length);
+    }
+
+    T max() const {
+        if (length == 0) throw std::underflow_error("Vector is empty");
+        return simd::max(buffer, length);
+    }
+
+    simd::sum_type<T> sum() const {
+        static_assert(std::is_arithmetic<T>::value, "T must be arithmetic to use sum");
+        return simd::sum(buffer, length);
+    }
+
+    // Print vector
+    void print() const {
+        std::cout << "[ ";
+        for (size_t i = 0; i < length; ++i)
+            std::cout << buffer[i] << " ";
+        std::cout << " ]\n";
+    }
+
+    FreqMap<T> create_freq_map(size_t threads = 1) const {
+        return frequency_count(buffer, length, threads);
+    }
+};
+
+} // namespace MayDSA
+
+#endif // MAYDSA_SMALL_VECTOR_HPP
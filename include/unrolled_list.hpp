@@ -0,0 +1,380 @@
+#ifndef MAYDSA_UNROLLED_LIST_HPP
+#define MAYDSA_UNROLLED_LIST_HPP
+
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "node_pool.hpp"
+
+namespace MayDSA{
+
+/**
+ * @brief Linked list of fixed-capacity blocks (an unrolled linked list).
+ *
+ * Each block stores up to BlockSize elements contiguously, so traversal takes
+ * one pointer hop (and usually one cache miss) per block instead of per
+ * element. Inserting into a full block splits it in half; removals merge a
+ * block with its successor once both fit in three quarters of a block. Same
+ * interface as LinkedList, except find() returns npos when the value is
+ * absent.
+ *
+ * @tparam BlockSize Elements per block (default sized for ~256-byte payloads).
+ */
+template<typename T, size_t BlockSize = (256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4)>
+class UnrolledList {
+    static_assert(BlockSize >= 2, "UnrolledList blocks need room for at least two elements");
+
+private:
+    struct Block {
+        Block* prev;
+        Block* next;
+        size_t count;
+        alignas(T) unsigned char storage[BlockSize * sizeof(T)];
+
+        Block(): prev(nullptr), next(nullptr), count(0) {}
+        T* elems() { return reinterpret_cast<T*>(storage); }
+    };
+
+    Block* head;
+    Block* tail;
+    size_t length;
+    NodePool<Block> pool;
+
+    Block* new_block_after(Block* b);
+    void free_block(Block* b);
+    void insert_in_block(Block* b, size_t idx, T&& val);
+    void erase_in_block(Block* b, size_t idx);
+    void split(Block* b);
+    void merge_with_next(Block* b);
+    // Block holding position pos (< length) and the offset inside it
+    std::pair<Block*, size_t> locate(size_t pos) const;
+
+    template<bool Const>
+    class Iter {
+        Block* block;
+        size_t idx;
+        friend class UnrolledList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+
+        Iter(Block* b, size_t i): block(b), idx(i) {}
+
+        reference operator*() const { return block->elems()[idx]; }
+        pointer operator->() const { return block->elems() + idx; }
+        Iter& operator++() {
+            if (++idx == block->count) {
+                block = block->next;
+                idx = 0;
+            }
+            return *this;
+        }
+        Iter operator++(int) { Iter tmp = *this; ++*this; return tmp; }
+        bool operator==(const Iter& other) const { return block == other.block && idx == other.idx; }
+        bool operator!=(const Iter& other) const { return !(*this == other); }
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iter<false>;
+    using const_iterator = Iter<true>;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr size_t block_size = BlockSize;
+
+    // Constructor and destructor
+    UnrolledList(): head(nullptr), tail(nullptr), length(0) {}
+    explicit UnrolledList(std::pmr::memory_resource* mr): head(nullptr), tail(nullptr), length(0), pool(mr) {}
+    UnrolledList(const UnrolledList& other);
+    UnrolledList& operator=(const UnrolledList& other);
+    ~UnrolledList();
+
+    // Core operations
+    void push_front(const T& val);
+    void push_back(const T& val);
+    void pop_front();
+    void pop_back();
+    void insert(size_t pos, const T& val);
+    void remove(size_t pos);
+    void reverse();
+    void clear();
+
+    // Utility
+    T& at(size_t pos);
+    const T& at(size_t pos) const;
+    size_t size() const;
+    bool empty() const;
+    size_t block_count() const;
+    size_t find(const T& val) const;
+    void print() const;
+
+    iterator begin() { return iterator(head, 0); }
+    iterator end() { return iterator(nullptr, 0); }
+    const_iterator begin() const { return const_iterator(head, 0); }
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+};
+
+template<typename T, size_t B>
+typename MayDSA::UnrolledList<T, B>::Block* MayDSA::UnrolledList<T, B>::new_block_after(Block* b) {
+    Block* nb = pool.create();
+    if (b) {
+        nb->prev = b;
+        nb->next = b->next;
+        if (b->next) b->next->prev = nb;
+        b->next = nb;
+        if (tail == b) tail = nb;
+    } else {
+        // b == nullptr: new head
+        nb->next = head;
+        if (head) head->prev = nb;
+        head = nb;
+        if (!tail) tail = nb;
+    }
+    return nb;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::free_block(Block* b) {
+    if (b->prev) b->prev->next = b->next; else head = b->next;
+    if (b->next) b->next->prev = b->prev; else tail = b->prev;
+    pool.destroy(b);
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::insert_in_block(Block* b, size_t idx, T&& val) {
+    T* e = b->elems();
+    if (idx == b->count) {
+        ::new (static_cast<void*>(e + idx)) T(std::move(val));
+    } else {
+        ::new (static_cast<void*>(e + b->count)) T(std::move(e[b->count - 1]));
+        std::move_backward(e + idx, e + b->count - 1, e + b->count);
+        e[idx] = std::move(val);
+    }
+    ++b->count;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::erase_in_block(Block* b, size_t idx) {
+    T* e = b->elems();
+    std::move(e + idx + 1, e + b->count, e + idx);
+    --b->count;
+    e[b->count].~T();
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::split(Block* b) {
+    Block* nb = new_block_after(b);
+    size_t keep = b->count / 2;
+    T* src = b->elems();
+    T* dst = nb->elems();
+    for (size_t i = keep; i < b->count; ++i) {
+        ::new (static_cast<void*>(dst + (i - keep))) T(std::move(src[i]));
+        src[i].~T();
+    }
+    nb->count = b->count - keep;
+    b->count = keep;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::merge_with_next(Block* b) {
+    Block* nb = b->next;
+    T* src = nb->elems();
+    T* dst = b->elems();
+    for (size_t i = 0; i < nb->count; ++i) {
+        ::new (static_cast<void*>(dst + b->count + i)) T(std::move(src[i]));
+        src[i].~T();
+    }
+    b->count += nb->count;
+    nb->count = 0;
+    free_block(nb);
+}
+
+template<typename T, size_t B>
+std::pair<typename MayDSA::UnrolledList<T, B>::Block*, size_t> MayDSA::UnrolledList<T, B>::locate(size_t pos) const {
+    // Walk whole blocks from the nearer end
+    if (pos < length / 2) {
+        Block* b = head;
+        while (pos >= b->count) {
+            pos -= b->count;
+            b = b->next;
+        }
+        return {b, pos};
+    }
+    Block* b = tail;
+    size_t from_back = length - pos;  // >= 1
+    while (from_back > b->count) {
+        from_back -= b->count;
+        b = b->prev;
+    }
+    return {b, b->count - from_back};
+}
+
+template<typename T, size_t B>
+MayDSA::UnrolledList<T, B>::UnrolledList(const UnrolledList& other)
+    : head(nullptr), tail(nullptr), length(0), pool(other.pool.get_resource()) {
+    for (const T& x : other) push_back(x);
+}
+
+template<typename T, size_t B>
+MayDSA::UnrolledList<T, B>& MayDSA::UnrolledList<T, B>::operator=(const UnrolledList& other) {
+    if (this != &other) {
+        clear();
+        for (const T& x : other) push_back(x);
+    }
+    return *this;
+}
+
+template<typename T, size_t B>
+MayDSA::UnrolledList<T, B>::~UnrolledList() {
+    clear();
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::clear() {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (Block* b = head; b; b = b->next)
+            for (size_t i = 0; i < b->count; ++i) b->elems()[i].~T();
+    }
+    pool.release();
+    head = tail = nullptr;
+    length = 0;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::push_front(const T& val) {
+    T tmp(val);
+    if (!head || head->count == B) new_block_after(nullptr);
+    insert_in_block(head, 0, std::move(tmp));
+    ++length;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::push_back(const T& val) {
+    T tmp(val);
+    if (!tail || tail->count == B) new_block_after(tail);
+    insert_in_block(tail, tail->count, std::move(tmp));
+    ++length;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::pop_front() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    erase_in_block(head, 0);
+    if (head->count == 0) free_block(head);
+    --length;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::pop_back() {
+    if (length == 0) throw std::out_of_range("List is empty");
+    erase_in_block(tail, tail->count - 1);
+    if (tail->count == 0) free_block(tail);
+    --length;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::insert(size_t pos, const T& val) {
+    if (pos > length) throw std::out_of_range("Index out of range");
+    if (pos == length) return push_back(val);
+
+    T tmp(val);
+    auto [b, idx] = locate(pos);
+    if (b->count == B) {
+        split(b);
+        if (idx > b->count) {
+            idx -= b->count;
+            b = b->next;
+        }
+    }
+    insert_in_block(b, idx, std::move(tmp));
+    ++length;
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::remove(size_t pos) {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    auto [b, idx] = locate(pos);
+    erase_in_block(b, idx);
+    --length;
+    if (b->count == 0) {
+        free_block(b);
+    } else if (b->next && b->count + b->next->count <= B / 2 + B / 4) {
+        // Merge only when the result leaves headroom, so alternating
+        // insert/remove at a boundary does not split and merge every time
+        merge_with_next(b);
+    }
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::reverse() {
+    Block* b = head;
+    while (b) {
+        std::reverse(b->elems(), b->elems() + b->count);
+        std::swap(b->prev, b->next);
+        b = b->prev;  // old next
+    }
+    std::swap(head, tail);
+}
+
+template<typename T, size_t B>
+T& MayDSA::UnrolledList<T, B>::at(size_t pos) {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    auto [b, idx] = locate(pos);
+    return b->elems()[idx];
+}
+
+template<typename T, size_t B>
+const T& MayDSA::UnrolledList<T, B>::at(size_t pos) const {
+    if (pos >= length) throw std::out_of_range("Index out of range");
+    auto [b, idx] = locate(pos);
+    return b->elems()[idx];
+}
+
+template<typename T, size_t B>
+size_t MayDSA::UnrolledList<T, B>::size() const {
+    return length;
+}
+
+template<typename T, size_t B>
+bool MayDSA::UnrolledList<T, B>::empty() const {
+    return length == 0;
+}
+
+template<typename T, size_t B>
+size_t MayDSA::UnrolledList<T, B>::block_count() const {
+    size_t n = 0;
+    for (Block* b = head; b; b = b->next) ++n;
+    return n;
+}
+
+template<typename T, size_t B>
+size_t MayDSA::UnrolledList<T, B>::find(const T& val) const {
+    size_t base = 0;
+    for (Block* b = head; b; b = b->next) {
+        const T* e = b->elems();
+        for (size_t i = 0; i < b->count; ++i)
+            if (e[i] == val) return base + i;
+        base += b->count;
+    }
+    return npos; // not found
+}
+
+template<typename T, size_t B>
+void MayDSA::UnrolledList<T, B>::print() const {
+    std::cout << "[ ";
+    for (const T& x : *this) std::cout << x << " ";
+    std::cout << "]\n";
+}
+
+} // namespace MayDSA
+
+#endif
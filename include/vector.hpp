@@ -4,6 +4,16 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <string>
+#include <new>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <functional>
+#include "simd.hpp"
+#include "frequency.hpp"
 
 /**
  * @brief A simple dynamic array implementation similar to std::vector.
@@ -13,79 +23,338 @@
 // WE ARE DEFINING VECTOR CLASS BELOW
 namespace MayDSA{
 
+/**
+ * @brief Non-owning view over a contiguous run of elements.
+ *
+ * Valid only while the underlying storage is alive and not reallocated.
+ */
+template<typename T>
+class Span {
+private:
+    T* ptr;
+    size_t len;
+
+public:
+    using value_type = std::remove_cv_t<T>;
+    using size_type = size_t;
+    using iterator = T*;
+
+    Span() : ptr(nullptr), len(0) {}
+    Span(T* first, size_t count) : ptr(first), len(count) {}
+
+    // Allow Span<T> -> Span<const T>
+    template<typename U, typename = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>>
+    Span(const Span<U>& other) : ptr(other.data()), len(other.size()) {}
+
+    T& operator[](size_t index) const { return ptr[index]; }
+
+    T& at(size_t index) const {
+        if (index >= len) throw std::out_of_range("Index out of bounds");
+        return ptr[index];
+    }
+
+    T* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+
+    T* begin() const { return ptr; }
+    T* end() const { return ptr + len; }
+
+    // Sub-view [offset, offset + count), clamped to the end
+    Span<T> subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const {
+        if (offset > len) throw std::out_of_range("Index out of bounds");
+        return Span<T>(ptr + offset, std::min(count, len - offset));
+    }
+};
+
+namespace detail {
+
+template<typename T>
+void destroy_range(T* first, T* last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; first != last; ++first) first->~T();
+    }
+}
+
+// Move (or copy, if T's move can throw) n elements from src into raw dst
+template<typename T>
+void relocate_range(T* src, size_t n, T* dst) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i)
+                ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+        } catch (...) {
+            destroy_range(dst, dst + i);
+            throw;
+        }
+        destroy_range(src, src + n);
+    }
+}
+
+// True if the pointer range starting at first reads from [data, data + n).
+// Only a pointer to T itself can alias; std::less gives a total order even
+// across unrelated arrays, where plain < is unspecified.
+template<typename T, typename InputIt>
+bool points_into(InputIt first, const T* data, size_t n) {
+    if constexpr (std::is_pointer<InputIt>::value &&
+                  std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value) {
+        const T* src = first;
+        std::less<const T*> before;
+        return !before(src, data) && before(src, data + n);
+    } else {
+        (void)first; (void)data; (void)n;
+        return false;
+    }
+}
+
+// Open a gap of k slots at index in data[0, length) and fill it from
+// [first, last). The caller guarantees capacity for length + k elements and
+// that the source does not alias data.
+template<typename T, typename InputIt>
+void insert_shift(T* data, size_t length, size_t index, size_t k, InputIt first, InputIt last) {
+    size_t tail = length - index;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(static_cast<void*>(data + index + k), static_cast<const void*>(data + index), tail * sizeof(T));
+        for (size_t j = index; first != last; ++first, ++j)
+            ::new (static_cast<void*>(data + j)) T(*first);
+    } else {
+        // Shift the tail up by k: slots past the old end are raw, the rest are live
+        for (size_t i = length; i-- > index;) {
+            if (i + k >= length)
+                ::new (static_cast<void*>(data + i + k)) T(std::move(data[i]));
+            else
+                data[i + k] = std::move(data[i]);
+        }
+        for (size_t j = index; first != last; ++first, ++j) {
+            if (j < length)
+                data[j] = *first;
+            else
+                ::new (static_cast<void*>(data + j)) T(*first);
+        }
+    }
+}
+
+// Close the gap [first, last) in data[0, length) with one compaction pass
+template<typename T>
+void erase_shift(T* data, size_t length, size_t first, size_t last) {
+    size_t k = last - first;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(static_cast<void*>(data + first), static_cast<const void*>(data + last), (length - last) * sizeof(T));
+    } else {
+        std::move(data + last, data + length, data + first);
+        destroy_range(data + length - k, data + length);
+    }
+}
+
+// Drop every element of data[0, length) matching pred; returns the new length
+template<typename T, typename Pred>
+size_t compact_if(T* data, size_t length, Pred& pred) {
+    size_t w = 0;
+    for (size_t r = 0; r < length; ++r) {
+        if (pred(data[r])) continue;
+        if (w != r) data[w] = std::move(data[r]);
+        ++w;
+    }
+    destroy_range(data + w, data + length);
+    return w;
+}
+
+} // namespace detail
+
 template<typename T>
 class Vector {
 private:
-    T* data;          // Pointer to the actual array
+    T* buffer;        // Pointer to the actual array (raw, uninitialized storage)
     size_t length;    // Number of elements stored
     size_t capacity;  // Allocated memory
 
+    static T* allocate(size_t n) {
+        return n == 0 ? nullptr : static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    static void deallocate(T* p) {
+        ::operator delete(static_cast<void*>(p));
+    }
+
+    static void destroy(T* first, T* last) {
+        detail::destroy_range(first, last);
+    }
+
+    static void relocate(T* src, size_t n, T* dst) {
+        detail::relocate_range(src, n, dst);
+    }
+
+    // Move storage to a fresh block of new_capacity slots
+    void reallocate(size_t new_capacity) {
+        T* new_data = allocate(new_capacity);
+        try {
+            relocate(buffer, length, new_data);
+        } catch (...) {
+            deallocate(new_data);
+            throw;
+        }
+        deallocate(buffer);
+        buffer = new_data;
+        capacity = new_capacity;
+    }
+
     // I am implementing 2* strategy for capacity
     void resize() {
-        capacity = capacity == 0 ? 1 : capacity * 2;
-        T* new_data = new T[capacity];
-        for (size_t i = 0; i < length; ++i) {
-            new_data[i] = data[i];
-        }
-        delete[] data;
-        data = new_data;
+        reallocate(capacity == 0 ? 1 : capacity * 2);
     }
 
 public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
     // Constructor
-    Vector() : data(nullptr), length(0), capacity(0) {}
+    Vector() : buffer(nullptr), length(0), capacity(0) {}
 
     // Destructor
     ~Vector() {
-        delete[] data;
+        destroy(buffer, buffer + length);
+        deallocate(buffer);
     }
 
     // Copy constructor
-    Vector(const Vector<T>& other) : data(new T[other.capacity]), length(other.length), capacity(other.capacity) {
-        for (size_t i = 0; i < length; ++i){
-            data[i] = other.data[i];
+    Vector(const Vector<T>& other) : buffer(allocate(other.length)), length(0), capacity(other.length) {
+        try {
+            std::uninitialized_copy(other.buffer, other.buffer + other.length, buffer);
+        } catch (...) {
+            deallocate(buffer);
+            throw;
         }
+        length = other.length;
     }
 
     // Move constructor
-    Vector(Vector<T>&& other) noexcept : data(other.data), length(other.length), capacity(other.capacity) {
-        other.data = nullptr;
+    Vector(Vector<T>&& other) noexcept : buffer(other.buffer), length(other.length), capacity(other.capacity) {
+        other.buffer = nullptr;
         other.length = 0;
         other.capacity = 0;
     }
 
-    // Access operator
+    // Copy and move assignment (copy-and-swap)
+    Vector<T>& operator=(Vector<T> other) noexcept {
+        std::swap(buffer, other.buffer);
+        std::swap(length, other.length);
+        std::swap(capacity, other.capacity);
+        return *this;
+    }
+
+    // Access operator (unchecked)
     T& operator[](size_t index) {
-        if (index >= length) throw std::out_of_range("Index out of bounds");
-        return data[index];
+        return buffer[index];
     }
 
     // Const version
     const T& operator[](size_t index) const {
+        return buffer[index];
+    }
+
+    // Bounds-checked access
+    T& at(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of bounds");
+        return buffer[index];
+    }
+
+    const T& at(size_t index) const {
         if (index >= length) throw std::out_of_range("Index out of bounds");
-        return data[index];
+        return buffer[index];
+    }
+
+    // Raw contiguous storage
+    T* data() { return buffer; }
+    const T* data() const { return buffer; }
+
+    // Contiguous iterators
+    T* begin() { return buffer; }
+    T* end() { return buffer + length; }
+    const T* begin() const { return buffer; }
+    const T* end() const { return buffer + length; }
+    const T* cbegin() const { return buffer; }
+    const T* cend() const { return buffer + length; }
+
+    // Non-owning views; invalidated by any reallocation
+    Span<T> span() { return Span<T>(buffer, length); }
+    Span<const T> span() const { return Span<const T>(buffer, length); }
+
+    Span<T> slice(size_t first, size_t count) {
+        return span().subspan(first, count);
+    }
+
+    Span<const T> slice(size_t first, size_t count) const {
+        return span().subspan(first, count);
     }
 
     // Add element to end
     void push_back(const T& value) {
-        if (length == capacity) resize();
-        data[length++] = value;
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // Construct element in place at the end
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (length == capacity) {
+            // Build into the new block first: args may alias an element we are about to move
+            size_t new_capacity = capacity == 0 ? 1 : capacity * 2;
+            T* new_data = allocate(new_capacity);
+            try {
+                ::new (static_cast<void*>(new_data + length)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data);
+                throw;
+            }
+            try {
+                relocate(buffer, length, new_data);
+            } catch (...) {
+                new_data[length].~T();
+                deallocate(new_data);
+                throw;
+            }
+            deallocate(buffer);
+            buffer = new_data;
+            capacity = new_capacity;
+        } else {
+            ::new (static_cast<void*>(buffer + length)) T(std::forward<Args>(args)...);
+        }
+        return buffer[length++];
     }
 
     // Remove last element
     void pop_back() {
         if (length == 0) throw std::underflow_error("Vector is empty");
         length--;
+        buffer[length].~T();
     }
 
     // Insert at position
     void insert(size_t index, const T& value) {
         if (index > length) throw std::out_of_range("Index out of bounds");
+        if (index == length) {
+            emplace_back(value);
+            return;
+        }
+        T tmp(value);
         if (length == capacity) resize();
-        for (size_t i = length; i > index; i--){
-            data[i] = data[i - 1];
+        ::new (static_cast<void*>(buffer + length)) T(std::move(buffer[length - 1]));
+        for (size_t i = length - 1; i > index; i--){
+            buffer[i] = std::move(buffer[i - 1]);
         }
-        data[index] = value;
+        buffer[index] = std::move(tmp);
         length++;
     }
 
@@ -93,15 +362,103 @@ public:
     void remove(size_t index) {
         if (index >= length) throw std::out_of_range("Index out of bounds");
         for (size_t i = index; i < length - 1; ++i){
-            data[i] = data[i + 1];
+            buffer[i] = std::move(buffer[i + 1]);
         }
         length--;
+        buffer[length].~T();
+    }
+
+    // Insert [first, last) before index: one reallocation at most, one pass over the tail
+    template<typename InputIt>
+    void insert_range(size_t index, InputIt first, InputIt last) {
+        if (index > length) throw std::out_of_range("Index out of bounds");
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, category>::value) {
+            // Single-pass input: materialize first so the count is known
+            Vector<T> tmp;
+            for (; first != last; ++first) tmp.emplace_back(*first);
+            insert_range(index, std::make_move_iterator(tmp.begin()), std::make_move_iterator(tmp.end()));
+            return;
+        } else {
+            if (detail::points_into(first, buffer, length)) {
+                // Source aliases our own storage: copy it out before shifting
+                Vector<T> tmp;
+                tmp.reserve(static_cast<size_t>(std::distance(first, last)));
+                for (; first != last; ++first) tmp.emplace_back(*first);
+                insert_range(index, std::make_move_iterator(tmp.begin()), std::make_move_iterator(tmp.end()));
+                return;
+            }
+            size_t k = static_cast<size_t>(std::distance(first, last));
+            if (k == 0) return;
+            size_t tail = length - index;
+
+            if (length + k > capacity) {
+                size_t new_capacity = std::max(capacity * 2, length + k);
+                T* new_data = allocate(new_capacity);
+                size_t built = 0;
+                try {
+                    for (; first != last; ++first, ++built)
+                        ::new (static_cast<void*>(new_data + index + built)) T(*first);
+                    relocate(buffer, index, new_data);
+                } catch (...) {
+                    destroy(new_data + index, new_data + index + built);
+                    deallocate(new_data);
+                    throw;
+                }
+                try {
+                    relocate(buffer + index, tail, new_data + index + k);
+                } catch (...) {
+                    // Prefix already moved out: drop everything rather than leave a torn vector
+                    destroy(new_data, new_data + index + k);
+                    deallocate(new_data);
+                    destroy(buffer + index, buffer + length);
+                    length = 0;
+                    throw;
+                }
+                deallocate(buffer);
+                buffer = new_data;
+                capacity = new_capacity;
+                length += k;
+                return;
+            }
+
+            detail::insert_shift(buffer, length, index, k, first, last);
+            length += k;
+        }
+    }
+
+    // Remove elements in [first, last) with a single compaction pass
+    void erase_range(size_t first, size_t last) {
+        if (first > last || last > length) throw std::out_of_range("Index out of bounds");
+        size_t k = last - first;
+        if (k == 0) return;
+        detail::erase_shift(buffer, length, first, last);
+        length -= k;
+    }
+
+    // Remove every element matching pred in one pass; returns how many were removed
+    template<typename Pred>
+    size_t erase_if(Pred pred) {
+        size_t w = detail::compact_if(buffer, length, pred);
+        size_t removed = length - w;
+        length = w;
+        return removed;
+    }
+
+    // Make room for at least n elements without changing size
+    void reserve(size_t n) {
+        if (n > capacity) reallocate(n);
+    }
+
+    // Release unused capacity
+    void shrink_to_fit() {
+        if (length < capacity) reallocate(length);
     }
 
     // Reverse the array
     void reverse() {
         for (size_t i = 0; i < length / 2; ++i)
-            std::swap(data[i], data[length - 1 - i]);
+            std::swap(buffer[i], buffer[length - 1 - i]);
     }
 
     // Return size
@@ -109,38 +466,64 @@ public:
         return length;
     }
 
+    bool empty() const {
+        return length == 0;
+    }
+
+    // Return allocated slots
+    size_t get_capacity() const {
+        return capacity;
+    }
+
     // Clear all elements
     void clear() {
+        destroy(buffer, buffer + length);
         length = 0;
     }
 
-    // Find first index of value, or -1
-    int find(const T& value) const {
-        for (size_t i = 0; i < length; ++i)
-            if (data[i] == value)
-                return i;
-        return -1;
+    // Find first index of value, or npos (SIMD-accelerated for arithmetic T)
+    size_t find(const T& value) const {
+        return simd::find(buffer, length, value);
+    }
+
+    // Number of elements equal to value
+    size_t count(const T& value) const {
+        return simd::count(buffer, length, value);
+    }
+
+    bool contains(const T& value) const {
+        return find(value) != npos;
+    }
+
+    // Smallest element
+    T min() const {
+        if (length == 0) throw std::underflow_error("Vector is empty");
+        return simd::min(buffer, length);
+    }
+
+    // Largest element
+    T max() const {
+        if (length == 0) throw std::underflow_error("Vector is empty");
+        return simd::max(buffer, length);
+    }
+
+    // Sum of all elements, widened to 64-bit integer or double
+    simd::sum_type<T> sum() const {
+        static_assert(std::is_arithmetic<T>::value, "T must be arithmetic to use sum");
+        return simd::sum(buffer, length);
     }
 
     // Print vector
     void print() const {
         std::cout << "[ ";
         for (size_t i = 0; i < length; ++i)
-            std::cout << data[i] << " ";
+            std::cout << buffer[i] << " ";
         std::cout << " ]\n";
     }
 
-    std::unordered_map<T,int> create_freq_map(){
-        // static_assert check at compile time (so no extra cost at runtime)
-        static_assert(
-            std::is_same<T, int>::value || std::is_same<T, std::string>::value,
-            "T must be int or std::string to use create_freq_map"
-        );
-        std::unordered_map<T,int> mp;
-        for(int i=0;i<length;i++){
-            mp[data[i]]++;
-        }
-        return mp;
+    // Count occurrences of each element (threads > 1 counts chunks in parallel, 0 = all cores)
+    FreqMap<T> create_freq_map(size_t threads = 1) const {
+        return frequency_count(buffer, length, threads);
     }
 
 